@@ -0,0 +1,7 @@
+set(
+    BENCHMARK_SOURCES
+
+    ${PROJECT_ROOT}/benchmarks/main.cpp
+    ${PROJECT_ROOT}/benchmarks/runner.cpp
+    ${PROJECT_ROOT}/benchmarks/workloads.cpp
+)
@@ -0,0 +1,172 @@
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <fmt/format.h>
+
+#include "Evaluator.hpp"
+#include "lexer.hpp"
+#include "Parser.hpp"
+#include "runner.hpp"
+#include "workloads.hpp"
+
+#define USAGE ( \
+    "Usage: benchmark [--iterations N] [--filter SUBSTRING] [--format json|csv] [--output FILE] [--size WORKLOAD=N]...\n" \
+    "Workloads: mixed, fib, loops, concat, functions\n" \
+)
+
+struct Options
+{
+    std::size_t iterations = 10;
+    std::string filter;
+    std::string format = "json";
+    std::string output;
+    std::map<std::string, std::size_t> sizes{
+        {"mixed", 2000},
+        {"fib", 20},
+        {"loops", 300},
+        {"concat", 2000},
+        {"functions", 1000}
+    };
+};
+
+static Options parseOptions(int ac, char **av)
+{
+    Options options;
+
+    for (int i = 1; i < ac; i++) {
+        const std::string flag(av[i]);
+
+        if (i + 1 >= ac)
+            throw std::invalid_argument(fmt::format("{}: missing value", flag));
+
+        const std::string value(av[++i]);
+
+        if (flag == "--iterations") {
+            options.iterations = std::stoul(value);
+        } else if (flag == "--filter") {
+            options.filter = value;
+        } else if (flag == "--format" && (value == "json" || value == "csv")) {
+            options.format = value;
+        } else if (flag == "--output") {
+            options.output = value;
+        } else if (flag == "--size") {
+            const auto separator = value.find('=');
+            const auto workload = value.substr(0, separator);
+
+            if (separator == std::string::npos || !options.sizes.contains(workload))
+                throw std::invalid_argument(fmt::format("{}: invalid size", value));
+
+            options.sizes[workload] = std::stoul(value.substr(separator + 1));
+        } else {
+            throw std::invalid_argument(fmt::format("{} {}: invalid option", flag, value));
+        }
+    }
+
+    return options;
+}
+
+static void addEvaluatorCases(
+    benchmark::Runner &runner,
+    const std::string &name,
+    std::size_t size,
+    const std::string &program
+)
+{
+    static const std::map<std::string, Evaluator::Mode> modes{
+        {"tree", Evaluator::Mode::TREE_WALKING},
+        {"bytecode", Evaluator::Mode::BYTECODE}
+    };
+
+    for (const auto &[modeName, mode]: modes) {
+        runner.add(benchmark::Case{
+            .name = fmt::format("{}/{}", name, modeName),
+            .size = size,
+            .bytes = program.size(),
+            .run = [program, mode]() {
+                // Printed values are discarded
+                std::ostream output(nullptr);
+                Evaluator evaluator(output, mode);
+
+                evaluator.feed(program);
+            }
+        });
+    }
+}
+
+static void addCases(benchmark::Runner &runner, const Options &options)
+{
+    const auto mixedSize = options.sizes.at("mixed");
+    const auto mixed = benchmark::mixedProgram(mixedSize);
+
+    runner.add(benchmark::Case{
+        .name = "lexer/feed",
+        .size = mixedSize,
+        .bytes = mixed.size(),
+        .run = [mixed]() {
+            Lexer lexer;
+
+            lexer.feed(mixed);
+        }
+    });
+
+    runner.add(benchmark::Case{
+        .name = "parser/feed",
+        .size = mixedSize,
+        .bytes = mixed.size(),
+        .run = [mixed]() {
+            Parser parser;
+
+            parser.feed(mixed);
+        }
+    });
+
+    addEvaluatorCases(runner, "evaluator/feed", mixedSize, mixed);
+
+    const auto fibSize = options.sizes.at("fib");
+    addEvaluatorCases(runner, "fib", fibSize, benchmark::fibProgram(fibSize));
+
+    const auto loopsSize = options.sizes.at("loops");
+    addEvaluatorCases(runner, "loops", loopsSize, benchmark::nestedLoopsProgram(loopsSize));
+
+    const auto concatSize = options.sizes.at("concat");
+    addEvaluatorCases(runner, "concat", concatSize, benchmark::stringConcatProgram(concatSize));
+
+    const auto functionsSize = options.sizes.at("functions");
+    addEvaluatorCases(runner, "functions", functionsSize, benchmark::manyFunctionsProgram(functionsSize));
+}
+
+int main(int ac, char **av)
+{
+    try {
+        const auto options = parseOptions(ac, av);
+        benchmark::Runner runner(options.iterations, options.filter);
+
+        addCases(runner, options);
+
+        const auto results = runner.run();
+        std::ofstream file;
+
+        if (!options.output.empty()) {
+            file.open(options.output);
+
+            if (!file)
+                throw std::runtime_error(fmt::format("{}: cannot open file", options.output));
+        }
+
+        auto &output = options.output.empty() ? std::cout : file;
+
+        if (options.format == "csv")
+            benchmark::writeCsv(output, results);
+        else
+            benchmark::writeJson(output, results);
+
+    } catch (const std::invalid_argument &err) {
+        std::cerr << "Error : " << err.what() << std::endl << USAGE;
+        return 1;
+    } catch (const std::exception &err) {
+        std::cerr << "Error : " << err.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
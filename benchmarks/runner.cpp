@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <fmt/format.h>
+
+#include "runner.hpp"
+
+benchmark::Runner::Runner(std::size_t iterations, std::string filter)
+:   _iterations(iterations ? iterations : 1),
+    _filter(std::move(filter)),
+    _cases()
+{}
+
+void benchmark::Runner::add(benchmark::Case benchmark)
+{
+    this->_cases.push_back(std::move(benchmark));
+}
+
+std::vector<benchmark::Result> benchmark::Runner::run() const
+{
+    std::vector<Result> results;
+
+    for (const auto &benchmark: this->_cases) {
+        if (benchmark.name.find(this->_filter) == std::string::npos)
+            continue;
+
+        results.push_back(this->measure(benchmark));
+    }
+
+    return results;
+}
+
+benchmark::Result benchmark::Runner::measure(const benchmark::Case &benchmark) const
+{
+    std::vector<double> durations;
+
+    durations.reserve(this->_iterations);
+    benchmark.run();
+
+    for (std::size_t i = 0; i < this->_iterations; i++) {
+        const auto start = std::chrono::steady_clock::now();
+
+        benchmark.run();
+
+        const auto end = std::chrono::steady_clock::now();
+
+        durations.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    std::sort(durations.begin(), durations.end());
+
+    return Result{
+        .name = benchmark.name,
+        .size = benchmark.size,
+        .bytes = benchmark.bytes,
+        .iterations = durations.size(),
+        .minNs = durations.front(),
+        .medianNs = durations[durations.size() / 2],
+        .meanNs = std::accumulate(durations.begin(), durations.end(), 0.0) / double(durations.size())
+    };
+}
+
+static double bytesPerSecond(const benchmark::Result &result)
+{
+    return result.medianNs > 0 ? double(result.bytes) * 1e9 / result.medianNs : 0;
+}
+
+void benchmark::writeJson(std::ostream &output, const std::vector<benchmark::Result> &results)
+{
+    output << "{\n  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const auto &result = results[i];
+
+        output << fmt::format(
+            "{}\n    {{\"name\": \"{}\", \"size\": {}, \"bytes\": {}, \"iterations\": {}, "
+            "\"min_ns\": {:.0f}, \"median_ns\": {:.0f}, \"mean_ns\": {:.0f}, \"bytes_per_second\": {:.0f}}}",
+            i ? "," : "",
+            result.name,
+            result.size,
+            result.bytes,
+            result.iterations,
+            result.minNs,
+            result.medianNs,
+            result.meanNs,
+            bytesPerSecond(result)
+        );
+    }
+
+    output << "\n  ]\n}" << std::endl;
+}
+
+void benchmark::writeCsv(std::ostream &output, const std::vector<benchmark::Result> &results)
+{
+    output << "name,size,bytes,iterations,min_ns,median_ns,mean_ns,bytes_per_second" << std::endl;
+
+    for (const auto &result: results) {
+        output << fmt::format(
+            "{},{},{},{},{:.0f},{:.0f},{:.0f},{:.0f}",
+            result.name,
+            result.size,
+            result.bytes,
+            result.iterations,
+            result.minNs,
+            result.medianNs,
+            result.meanNs,
+            bytesPerSecond(result)
+        ) << std::endl;
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+    struct Case
+    {
+        std::string name;
+
+        // Size parameter the input of the case was generated with
+        std::size_t size;
+
+        // Bytes of source code processed by each run
+        std::size_t bytes;
+
+        std::function<void()> run;
+    };
+
+    struct Result
+    {
+        std::string name;
+        std::size_t size;
+        std::size_t bytes;
+        std::size_t iterations;
+        double minNs;
+        double medianNs;
+        double meanNs;
+    };
+
+    // Times each registered case over a fixed number of iterations, after a warmup run.
+    class Runner
+    {
+        public:
+            explicit Runner(std::size_t iterations, std::string filter = "");
+            ~Runner() = default;
+
+            void add(Case benchmark);
+
+            [[nodiscard]] std::vector<Result> run() const;
+
+        private:
+            std::size_t _iterations;
+            std::string _filter;
+            std::vector<Case> _cases;
+
+            [[nodiscard]] Result measure(const Case &benchmark) const;
+    };
+
+    void writeJson(std::ostream &output, const std::vector<Result> &results);
+    void writeCsv(std::ostream &output, const std::vector<Result> &results);
+};
@@ -0,0 +1,83 @@
+#include <fmt/format.h>
+
+#include "workloads.hpp"
+
+std::string benchmark::mixedProgram(std::size_t groups)
+{
+    std::string program;
+
+    for (std::size_t i = 0; i < groups; i++) {
+        program += fmt::format(
+            "int v{0} = {0} * 3 + 1;\n"
+            "str s{0} = \"text {0}\";\n"
+            "if (v{0} % 2 == 0) {{\n"
+            "    v{0} = v{0} / 2;\n"
+            "}} else {{\n"
+            "    v{0} = (v{0} << 1) + 1;\n"
+            "}}\n"
+            "while (v{0} > 1) {{\n"
+            "    v{0} = v{0} / 2;\n"
+            "}}\n",
+            i
+        );
+    }
+
+    return program;
+}
+
+std::string benchmark::fibProgram(std::size_t n)
+{
+    return fmt::format(
+        "fnc fib(int n) int {{\n"
+        "    if (n < 2) {{\n"
+        "        return n;\n"
+        "    }}\n"
+        "    return fib(n - 1) + fib(n - 2);\n"
+        "}}\n"
+        "print(fib({}));\n",
+        n
+    );
+}
+
+std::string benchmark::nestedLoopsProgram(std::size_t n)
+{
+    return fmt::format(
+        "int total = 0;\n"
+        "for (int i = 0; i < {0}; i++) {{\n"
+        "    for (int j = 0; j < {0}; j++) {{\n"
+        "        total += (i ^ j) & 7;\n"
+        "    }}\n"
+        "}}\n"
+        "print(total);\n",
+        n
+    );
+}
+
+std::string benchmark::stringConcatProgram(std::size_t n)
+{
+    return fmt::format(
+        "str s = \"\";\n"
+        "for (int i = 0; i < {}; i++) {{\n"
+        "    s += \"ab\";\n"
+        "}}\n"
+        "print(s);\n",
+        n
+    );
+}
+
+std::string benchmark::manyFunctionsProgram(std::size_t n)
+{
+    std::string program;
+
+    for (std::size_t i = 0; i < n; i++)
+        program += fmt::format("fnc f{0}(int x) int {{\n    return x + {0};\n}}\n", i);
+
+    program += "int acc = 0;\n";
+
+    for (std::size_t i = 0; i < n; i++)
+        program += fmt::format("acc = f{}(acc);\n", i);
+
+    program += "print(acc);\n";
+
+    return program;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Generators of Hudson programs used as benchmark inputs.
+namespace benchmark
+{
+    // Declarations, conditions, loops and strings, repeated over the given number of statement groups.
+    std::string mixedProgram(std::size_t groups);
+
+    // Naive recursive fibonacci of n.
+    std::string fibProgram(std::size_t n);
+
+    // Two nested for loops of n iterations each.
+    std::string nestedLoopsProgram(std::size_t n);
+
+    // A string built by n concatenations.
+    std::string stringConcatProgram(std::size_t n);
+
+    // n function declarations, then a call to each of them.
+    std::string manyFunctionsProgram(std::size_t n);
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ast
+{
+    // Bump allocator holding the nodes of a parsed program contiguously.
+    // Nodes created while an Arena::Scope is active are allocated in its arena, and keep it alive through
+    // their allocator : the memory is released block by block once the last node is gone.
+    class Arena final : public std::enable_shared_from_this<Arena>
+    {
+        public:
+            using ptr = std::shared_ptr<Arena>;
+            static ptr create();
+
+            Arena() = default;
+            ~Arena() = default;
+
+            Arena(const Arena &) = delete;
+            Arena &operator=(const Arena &) = delete;
+
+            void *allocate(std::size_t size, std::size_t alignment);
+
+            // Bytes reserved by the arena
+            [[nodiscard]] std::size_t capacity() const noexcept;
+
+            template<typename T>
+            class Allocator
+            {
+                public:
+                    using value_type = T;
+
+                    explicit Allocator(Arena::ptr arena) noexcept : _arena(std::move(arena)) {}
+
+                    template<typename U>
+                    Allocator(const Allocator<U> &other) noexcept : _arena(other.getArena()) {}
+
+                    T *allocate(std::size_t n)
+                    {
+                        return static_cast<T *>(this->_arena->allocate(n * sizeof(T), alignof(T)));
+                    }
+
+                    // Memory is only released with the whole arena
+                    void deallocate(T *, std::size_t) noexcept {}
+
+                    [[nodiscard]] const Arena::ptr &getArena() const noexcept { return this->_arena; }
+
+                    template<typename U>
+                    bool operator==(const Allocator<U> &other) const noexcept { return this->_arena == other.getArena(); }
+
+                private:
+                    Arena::ptr _arena;
+            };
+
+            // Makes the arena the one nodes are created in, until the scope is destroyed
+            class Scope
+            {
+                public:
+                    explicit Scope(Arena &arena) noexcept;
+                    ~Scope();
+
+                    Scope(const Scope &) = delete;
+                    Scope &operator=(const Scope &) = delete;
+
+                private:
+                    Arena *_previous;
+            };
+
+            // Creates a node in the current arena, or on the heap outside of any Arena::Scope
+            template<typename T, typename ...Args>
+            static std::shared_ptr<T> make(Args &&...args)
+            {
+                if (!Arena::_current)
+                    return std::make_shared<T>(std::forward<Args>(args)...);
+
+                return std::allocate_shared<T>(
+                    Allocator<T>(Arena::_current->shared_from_this()),
+                    std::forward<Args>(args)...
+                );
+            }
+
+        private:
+            std::vector<std::unique_ptr<std::byte[]>> _blocks;
+            std::byte *_head = nullptr;
+            std::byte *_end = nullptr;
+            std::size_t _capacity = 0;
+
+            static thread_local Arena *_current;
+
+            void grow(std::size_t size);
+    };
+};
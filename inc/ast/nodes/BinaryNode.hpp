@@ -2,6 +2,7 @@
 
 #include "ExpressionNode.hpp"
 #include "token.hpp"
+#include "Specialization.hpp"
 
 namespace ast
 {
@@ -23,14 +24,24 @@ namespace ast
             ~BinaryNode() final = default;
 
             void accept(IVisitor &visitor) override;
+            runtime::Object evaluate(IExpressionVisitor &visitor) override;
             [[nodiscard]] Token::Type getOperator() const;
 
             [[nodiscard]] const ExpressionNode::ptr &getLeftChild() const;
             [[nodiscard]] const ExpressionNode::ptr &getRightChild() const;
 
+            // Replaced by FoldVisitor once folded
+            void setLeftChild(ExpressionNode::ptr child) noexcept;
+            void setRightChild(ExpressionNode::ptr child) noexcept;
+
+            // Rewritten by EvalVisitor as it is executed
+            void specialize(Specialization specialization) noexcept;
+            [[nodiscard]] Specialization getSpecialization() const noexcept;
+
         private:
             Token::Type _operator;
             ExpressionNode::ptr _leftChild;
             ExpressionNode::ptr _rightChild;
+            Specialization _specialization;
     };
 };
\ No newline at end of file
@@ -1,8 +1,9 @@
 #pragma once
 
-#include <list>
+#include <vector>
 
 #include "StatementNode.hpp"
+#include "Layout.hpp"
 
 namespace ast
 {
@@ -10,17 +11,31 @@ namespace ast
     {
         public:
             using ptr = std::shared_ptr<BlockNode>;
-            static ptr create(const std::list<StatementNode::ptr> &statements);
+            static ptr create(std::vector<StatementNode::ptr> statements);
 
-            explicit BlockNode(std::list<StatementNode::ptr> statements);
+            explicit BlockNode(std::vector<StatementNode::ptr> statements);
             ~BlockNode() final = default;
 
             void accept(IVisitor &visitor) final;
 
-            [[nodiscard]] const std::list<StatementNode::ptr> &getStatements() const;
+            [[nodiscard]] const std::vector<StatementNode::ptr> &getStatements() const;
+
+            // Replaced by FoldVisitor once folded
+            void setStatements(std::vector<StatementNode::ptr> statements) noexcept;
+
+            // Identifiers declared in the scope, resolved by ResolveVisitor
+            void setLayout(runtime::Layout layout) noexcept;
+            [[nodiscard]] const runtime::Layout &getLayout() const noexcept;
+
+            // Whether the block opens a scope, resolved by ResolveVisitor : blocks which declare nothing run in the
+            // scope enclosing them.
+            void setScoped(bool scoped) noexcept;
+            [[nodiscard]] bool isScoped() const noexcept;
 
         private:
-            std::list<StatementNode::ptr> _statements;
+            std::vector<StatementNode::ptr> _statements;
+            runtime::Layout _layout;
+            bool _scoped;
     };
 
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -7,6 +8,8 @@
 
 namespace ast
 {
+    class FunctionNode;
+
     class CallNode final : public ExpressionNode
     {
         public:
@@ -22,12 +25,43 @@ namespace ast
         ~CallNode() final = default;
 
         void accept(IVisitor &visitor) final;
+        runtime::Object evaluate(IExpressionVisitor &visitor) final;
 
         [[nodiscard]] const ExpressionNode::ptr &getCallee() const;
         [[nodiscard]] const std::vector<ast::ExpressionNode::ptr>  &getParams() const;
 
+        // Replaced by FoldVisitor once folded
+        void setParam(std::size_t index, ExpressionNode::ptr param) noexcept;
+
+        // Whether the arguments are known to match the parameters of the callee, checked by TypeVisitor
+        void setChecked(bool checked) noexcept;
+        [[nodiscard]] bool isChecked() const noexcept;
+
+        // Whether the call is returned by the function it is made in, resolved by ResolveVisitor.
+        // A call to that same function then reuses its frame.
+        void setTailCall(bool tailCall) noexcept;
+        [[nodiscard]] bool isTailCall() const noexcept;
+
+        // Whether the value of the call is used, rather than discarded by an expression statement or returned as is,
+        // resolved by ResolveVisitor. A call to a function returning no value fails when it is.
+        void setValueUsed(bool valueUsed) noexcept;
+        [[nodiscard]] bool isValueUsed() const noexcept;
+
+        // Inline cache of the function last called from the call site, along with whether the static types of the
+        // arguments match its parameters. It is held weakly, as its body may hold the call site : once it expires, or
+        // once the callee is reassigned another function, the entry is no longer used.
+        void cache(const std::shared_ptr<const FunctionNode> &function, bool checked);
+        [[nodiscard]] bool isCached(const FunctionNode &function) const noexcept;
+        [[nodiscard]] bool isCacheChecked() const noexcept;
+
         private:
         ExpressionNode::ptr _callee;
         std::vector<ast::ExpressionNode::ptr> _params;
+        bool _checked;
+        bool _tailCall;
+        bool _valueUsed;
+        std::weak_ptr<const FunctionNode> _cachedFunction;
+        const FunctionNode *_cachedAddress;
+        bool _cacheChecked;
     };
 };
\ No newline at end of file
@@ -27,6 +27,11 @@ namespace ast
             [[nodiscard]] const StatementNode::ptr &getIfBranch() const;
             [[nodiscard]] const StatementNode::ptr &getElseBranch() const;
 
+            // Replaced by FoldVisitor once folded
+            void setExpression(ExpressionNode::ptr expression) noexcept;
+            void setIfBranch(StatementNode::ptr branch) noexcept;
+            void setElseBranch(StatementNode::ptr branch) noexcept;
+
         private:
             ExpressionNode::ptr _expr;
             StatementNode::ptr _ifBranch;
@@ -30,9 +30,17 @@ namespace ast
             [[nodiscard]] const std::string &getIdentifier() const;
             [[nodiscard]] const ExpressionNode::ptr &getExpression() const;
 
+            // Replaced by FoldVisitor once folded
+            void setExpression(ExpressionNode::ptr expression) noexcept;
+
+            // Resolved by ResolveVisitor
+            void setSlot(std::size_t slot) noexcept;
+            [[nodiscard]] std::size_t getSlot() const noexcept;
+
         private:
             Token::Type _type;
             std::string _identifier;
             ExpressionNode::ptr _expression;
+            std::size_t _slot;
     };
 };
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <optional>
+
 #include "INode.hpp"
+#include "IExpressionVisitor.hpp"
+#include "token.hpp"
 
 namespace ast
 {
@@ -8,5 +12,14 @@ namespace ast
     {
         public:
             using ptr = std::shared_ptr<ExpressionNode>;
+
+            virtual runtime::Object evaluate(IExpressionVisitor &visitor) = 0;
+
+            // Type of the value, inferred by TypeVisitor. Unknown when it can only be found out at runtime.
+            void setType(std::optional<Token::Type> type) noexcept;
+            [[nodiscard]] std::optional<Token::Type> getType() const noexcept;
+
+        private:
+            std::optional<Token::Type> _type;
     };
-};
\ No newline at end of file
+};
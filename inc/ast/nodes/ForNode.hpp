@@ -2,6 +2,7 @@
 
 #include "StatementNode.hpp"
 #include "ExpressionNode.hpp"
+#include "Layout.hpp"
 
 namespace ast
 {
@@ -30,10 +31,19 @@ namespace ast
             [[nodiscard]] const StepStatementNode::ptr &getStepStatement() const;
             [[nodiscard]] const InitStatementNode::ptr &getInitStatement() const;
 
+            // Replaced by FoldVisitor once folded
+            void setExpression(ExpressionNode::ptr expression) noexcept;
+            void setStatement(StatementNode::ptr statement) noexcept;
+
+            // Identifiers declared in the scope, resolved by ResolveVisitor
+            void setLayout(runtime::Layout layout) noexcept;
+            [[nodiscard]] const runtime::Layout &getLayout() const noexcept;
+
         private:
             ExpressionNode::ptr _expr;
             InitStatementNode::ptr _init;
             StepStatementNode::ptr _step;
             StatementNode::ptr _stmt;
+            runtime::Layout _layout;
     };
 };
\ No newline at end of file
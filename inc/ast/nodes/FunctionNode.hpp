@@ -1,15 +1,18 @@
 #pragma once
 
 #include <map>
+#include <memory>
 
 #include "token.hpp"
 #include "StatementNode.hpp"
 #include "ExpressionNode.hpp"
 #include "BlockNode.hpp"
+#include "Layout.hpp"
 
 namespace ast
 {
-    class FunctionNode final : public StatementNode
+    // Function objects refer to their declaration through shared_from_this(), rather than copying it
+    class FunctionNode final : public StatementNode, public std::enable_shared_from_this<FunctionNode>
     {
         public:
 
@@ -40,10 +43,27 @@ namespace ast
         [[nodiscard]] const std::vector<Param> &getParams() const;
         [[nodiscard]] Token::Type getReturnType() const;
 
+        // Resolved by ResolveVisitor : slot of the function in its declaring scope, identifiers of the scope holding
+        // its parameters, and global slots of the identifiers declared by its scopes.
+        void setSlot(std::size_t slot) noexcept;
+        [[nodiscard]] std::size_t getSlot() const noexcept;
+        void setFrame(runtime::Layout frame) noexcept;
+        [[nodiscard]] const runtime::Layout &getFrame() const noexcept;
+        void setLocals(std::vector<std::size_t> locals) noexcept;
+        [[nodiscard]] const std::vector<std::size_t> &getLocals() const noexcept;
+
+        // Whether every returned value is known to be of the return type, checked by TypeVisitor
+        void setReturnChecked(bool checked) noexcept;
+        [[nodiscard]] bool isReturnChecked() const noexcept;
+
         private:
             std::string _identifier;
             std::vector<Param> _params;
             Token::Type _returnType;
             BlockNode::ptr _block;
+            std::size_t _slot;
+            runtime::Layout _frame;
+            std::vector<std::size_t> _locals;
+            bool _returnChecked;
     };
 };
\ No newline at end of file
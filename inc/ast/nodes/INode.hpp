@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+
+#include "Arena.hpp"
 #include "IVisitor.hpp"
 
 namespace ast
@@ -2,9 +2,13 @@
 
 #include "ExpressionNode.hpp"
 #include "token.hpp"
+#include "Address.hpp"
+
 
 namespace ast
 {
+    class FunctionNode;
+
     class IdentifierNode final : public ExpressionNode
     {
         public:
@@ -15,9 +19,21 @@ namespace ast
             ~IdentifierNode() final = default;
 
             void accept(IVisitor &visitor) override;
+            runtime::Object evaluate(IExpressionVisitor &visitor) override;
             [[nodiscard]] const std::string &getIdentifier() const noexcept;
 
+            // Resolved by ResolveVisitor
+            void setAddress(const runtime::Address &address) noexcept;
+            [[nodiscard]] const runtime::Address &getAddress() const noexcept;
+
+            // Declaration of the function the identifier refers to, when it is known before execution.
+            // Resolved by ResolveVisitor.
+            void setFunction(const FunctionNode *function) noexcept;
+            [[nodiscard]] const FunctionNode *getFunction() const noexcept;
+
         private:
             std::string _identifier;
+            runtime::Address _address;
+            const FunctionNode *_function;
     };
 };
\ No newline at end of file
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <optional>
+
 #include "StatementNode.hpp"
 #include "token.hpp"
+#include "Address.hpp"
+#include "Specialization.hpp"
 
 namespace ast
 {
@@ -26,8 +30,23 @@ namespace ast
         [[nodiscard]] const std::string &getIdentifier() const;
         [[nodiscard]] Token::Type getOperator() const;
 
+        // Resolved by ResolveVisitor
+        void setAddress(const runtime::Address &address) noexcept;
+        [[nodiscard]] const runtime::Address &getAddress() const noexcept;
+
+        // Declared type of the identifier, when it is known before execution
+        void setTargetType(std::optional<Token::Type> type) noexcept;
+        [[nodiscard]] std::optional<Token::Type> getTargetType() const noexcept;
+
+        // Rewritten by EvalVisitor as it is executed
+        void specialize(Specialization specialization) noexcept;
+        [[nodiscard]] Specialization getSpecialization() const noexcept;
+
         private:
         std::string _identifier;
         Token::Type _op;
+        runtime::Address _address;
+        std::optional<Token::Type> _targetType;
+        Specialization _specialization;
     };
 };
\ No newline at end of file
@@ -15,6 +15,7 @@ namespace ast
             virtual ~IntegerNode() final = default;
 
             void accept(IVisitor &visitor) override;
+            runtime::Object evaluate(IExpressionVisitor &visitor) override;
 
             [[nodiscard]] Token::Integer getValue() const;
 
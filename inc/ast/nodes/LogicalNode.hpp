@@ -24,11 +24,16 @@ namespace ast
             ~LogicalNode() final = default;
 
             void accept(IVisitor &visitor) override;
+            runtime::Object evaluate(IExpressionVisitor &visitor) override;
             [[nodiscard]] Token::Type getOperator() const;
 
             [[nodiscard]] const ExpressionNode::ptr &getLeftChild() const;
             [[nodiscard]] const ExpressionNode::ptr &getRightChild() const;
 
+            // Replaced by FoldVisitor once folded
+            void setLeftChild(ExpressionNode::ptr child) noexcept;
+            void setRightChild(ExpressionNode::ptr child) noexcept;
+
         private:
             Token::Type _operator;
             ExpressionNode::ptr _leftChild;
@@ -18,6 +18,9 @@ namespace ast
 
             [[nodiscard]] const ExpressionNode::ptr &getExpression() const;
 
+            // Replaced by FoldVisitor once folded
+            void setExpression(ExpressionNode::ptr expression) noexcept;
+
         private:
             ExpressionNode::ptr _expression;
     };
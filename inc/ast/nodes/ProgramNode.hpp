@@ -1,6 +1,6 @@
 #pragma once
 
-#include <list>
+#include <vector>
 #include "StatementNode.hpp"
 
 namespace ast
@@ -9,16 +9,19 @@ namespace ast
     {
         public:
             using ptr = std::shared_ptr<ProgramNode>;
-            static ptr create(const std::list<StatementNode::ptr> &statements);
+            static ptr create(std::vector<StatementNode::ptr> statements);
 
-            ProgramNode(const std::list<StatementNode::ptr> &statements);
+            ProgramNode(std::vector<StatementNode::ptr> statements);
             ~ProgramNode() final = default;
 
             void accept(IVisitor &visitor) final;
 
-            [[nodiscard]] const std::list<StatementNode::ptr> &getStatements() const;
+            [[nodiscard]] const std::vector<StatementNode::ptr> &getStatements() const;
+
+            // Replaced by FoldVisitor once folded
+            void setStatements(std::vector<StatementNode::ptr> statements) noexcept;
 
         private:
-            std::list<StatementNode::ptr> _statements;
+            std::vector<StatementNode::ptr> _statements;
     };
 };
\ No newline at end of file
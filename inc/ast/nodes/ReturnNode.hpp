@@ -21,6 +21,9 @@ namespace ast
 
         [[nodiscard]] const ExpressionNode::ptr &getExpression() const;
 
+        // Replaced by FoldVisitor once folded
+        void setExpression(ExpressionNode::ptr expression) noexcept;
+
         private:
             ExpressionNode::ptr _expr;
 
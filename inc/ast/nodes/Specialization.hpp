@@ -0,0 +1,15 @@
+#pragma once
+
+namespace ast
+{
+    // Variant of its operation a node rewrites itself into once executed, after the types of the operands it
+    // observed. A specialized node runs its variant for as long as its operands keep these types, and goes back to the
+    // generic operation for good once they don't.
+    enum class Specialization
+    {
+        UNSPECIALIZED,
+        INTEGER,
+        STRING,
+        GENERIC
+    };
+};
@@ -15,6 +15,7 @@ namespace ast
             ~StringNode() final = default;
 
             void accept(IVisitor &visitor) override;
+            runtime::Object evaluate(IExpressionVisitor &visitor) override;
 
             [[nodiscard]] const Token::String &getValue() const;
 
@@ -15,11 +15,15 @@ namespace ast
             virtual ~UnaryNode() final = default;
 
             void accept(IVisitor &visitor) final;
+            runtime::Object evaluate(IExpressionVisitor &visitor) final;
 
             [[nodiscard]] Token::Type getOperator() const;
 
             [[nodiscard]] const ExpressionNode::ptr &getChild() const;
 
+            // Replaced by FoldVisitor once folded
+            void setChild(ExpressionNode::ptr child) noexcept;
+
         private:
             Token::Type _operator;
             ExpressionNode::ptr _child;
@@ -19,6 +19,10 @@ namespace ast
             [[nodiscard]] const ExpressionNode::ptr &getExpression() const;
             [[nodiscard]] const StatementNode::ptr &getStatement() const;
 
+            // Replaced by FoldVisitor once folded
+            void setExpression(ExpressionNode::ptr expression) noexcept;
+            void setStatement(StatementNode::ptr statement) noexcept;
+
         private:
             ExpressionNode::ptr _expr;
             StatementNode::ptr _stmt;
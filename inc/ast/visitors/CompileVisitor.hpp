@@ -0,0 +1,95 @@
+#pragma once
+
+#include <vector>
+
+#include "IVisitor.hpp"
+#include "IntegerNode.hpp"
+#include "StringNode.hpp"
+#include "BinaryNode.hpp"
+#include "ExpressionNode.hpp"
+#include "UnaryNode.hpp"
+#include "LogicalNode.hpp"
+#include "IdentifierNode.hpp"
+
+#include "ExpressionStatementNode.hpp"
+#include "DeclarationNode.hpp"
+#include "AssignmentNode.hpp"
+#include "PrintNode.hpp"
+#include "BlockNode.hpp"
+#include "WhileNode.hpp"
+#include "ConditionNode.hpp"
+#include "ForNode.hpp"
+#include "IncrementNode.hpp"
+
+#include "FunctionNode.hpp"
+#include "ReturnNode.hpp"
+#include "CallNode.hpp"
+
+#include "BreakNode.hpp"
+#include "ContinueNode.hpp"
+
+#include "ProgramNode.hpp"
+
+#include "Chunk.hpp"
+
+namespace ast
+{
+    // Lowers an AST into a linear vm::Chunk executed by vm::VirtualMachine.
+    class CompileVisitor final : public IVisitor
+    {
+        public:
+            CompileVisitor();
+            ~CompileVisitor() final = default;
+
+            void visit(IntegerNode &node) final;
+            void visit(StringNode &node) final;
+            void visit(BinaryNode &node) final;
+            void visit(UnaryNode &node) final;
+            void visit(LogicalNode &node) final;
+            void visit(IdentifierNode &node) final;
+
+            void visit(ExpressionStatementNode &node) final;
+            void visit(DeclarationNode &node) final;
+            void visit(AssignmentNode &node) final;
+            void visit(PrintNode &node) final;
+            void visit(BlockNode &node) final;
+            void visit(WhileNode &node) final;
+            void visit(ConditionNode &node) final;
+            void visit(ForNode &node) final;
+            void visit(IncrementNode &node) final;
+
+            void visit(FunctionNode &node) final;
+            void visit(CallNode &node) final;
+            void visit(ReturnNode &node) final;
+
+            void visit(BreakNode &node) final;
+            void visit(ContinueNode &node) final;
+
+            void visit(ProgramNode &node) final;
+
+            [[nodiscard]] vm::Chunk &getChunk() noexcept;
+
+        private:
+            struct Loop
+            {
+                std::size_t scopeDepth;
+                std::vector<std::size_t> breakJumps;
+                std::vector<std::size_t> continueJumps;
+            };
+
+            vm::Chunk _chunk;
+            std::vector<Loop> _loops;
+            std::size_t _scopeDepth;
+            bool _inFunction;
+
+            void compile(const ExpressionNode::ptr &expr);
+            void compile(const StatementNode::ptr &stmt);
+
+            std::size_t emitJump(vm::Chunk::OpCode opcode);
+            void patchJump(std::size_t jump);
+            void patchJumps(const std::vector<std::size_t> &jumps, std::size_t target);
+            void emitExitScopes(std::size_t scopeDepth);
+
+            void compileLoopBody(const StatementNode::ptr &stmt, Loop &loop);
+    };
+};
@@ -1,8 +1,7 @@
 #pragma once
 
-#include <iostream>
-
 #include "IVisitor.hpp"
+#include "IExpressionVisitor.hpp"
 #include "IntegerNode.hpp"
 #include "StringNode.hpp"
 #include "BinaryNode.hpp"
@@ -32,13 +31,23 @@
 
 #include "State.hpp"
 #include "Object.hpp"
+#include "Builtin.hpp"
+#include "Output.hpp"
 
 namespace ast
 {
-    class EvalVisitor final : public IVisitor
+    // Executes statements through IVisitor, and evaluates expressions through IExpressionVisitor.
+    // Visiting an expression evaluates it and discards its value.
+    class EvalVisitor final : public IVisitor, public IExpressionVisitor
     {
         public:
-            explicit EvalVisitor(std::ostream &output = std::cout);
+            // Fits in runtime::NativeStack, which programs run on
+            static constexpr std::size_t DEFAULT_MAX_CALL_DEPTH = 100000;
+
+            explicit EvalVisitor(
+                runtime::Output::ptr output = runtime::Output::create(),
+                runtime::State::ptr globalState = runtime::State::create()
+            );
             ~EvalVisitor() final = default;
 
             void visit(IntegerNode &node) final;
@@ -67,6 +76,14 @@ namespace ast
 
             void visit(ProgramNode &node) final;
 
+            runtime::Object evaluate(IntegerNode &node) final;
+            runtime::Object evaluate(StringNode &node) final;
+            runtime::Object evaluate(BinaryNode &node) final;
+            runtime::Object evaluate(UnaryNode &node) final;
+            runtime::Object evaluate(LogicalNode &node) final;
+            runtime::Object evaluate(IdentifierNode &node) final;
+            runtime::Object evaluate(CallNode &node) final;
+
             [[nodiscard]] const runtime::Object &value() const noexcept;
             [[nodiscard]] Token::Integer getResult() const;
 
@@ -74,16 +91,75 @@ namespace ast
 
             void clearState() noexcept;
 
-        private:
-            std::ostream &_output;
-            runtime::Object _expressionResult;
-            runtime::State::ptr _localState;
+            // Calls nested deeper fail, as do calls left without room on the native stack. Tail calls don't nest.
+            void setMaxCallDepth(std::size_t depth) noexcept;
+            [[nodiscard]] std::size_t getMaxCallDepth() const noexcept;
 
-            const runtime::Object &evaluate(const ast::ExpressionNode::ptr &expr);
+            static LogicalError invalidArgType(std::string paramName, Token::Type actualType, Token::Type expectedType);
+            static LogicalError invalidReturnType(Token::Type actualType, Token::Type expectedType);
+            static LogicalError missingReturn(Token::Type actualType);
+            static LogicalError noReturnValue(std::string_view identifier);
+            // The chain lists the functions being called, the outermost first
+            static LogicalError callDepthExceeded(std::size_t maxDepth, const std::vector<std::string_view> &chain);
 
-        static LogicalError invalidArgType(std::string paramName, Token::Type actualType, Token::Type expectedType);
-        static LogicalError invalidReturnType(Token::Type actualType, Token::Type expectedType);
-        static LogicalError missingReturn(Token::Type actualType);
+        private:
+            // How the last executed statement completed.
+            // Jumps are propagated through enclosing statements until a loop or a call handles them.
+            enum class Completion
+            {
+                NORMAL,
+                BREAK,
+                CONTINUE,
+                RETURN,
+                // Return of a call to the function being executed, which runs again in place
+                TAIL_CALL
+            };
+
+            runtime::Output::ptr _output;
+            // Value of the last expression evaluated by a statement, as kept by vm::VirtualMachine
+            runtime::Object _result;
+            Completion _completion;
+            std::optional<runtime::Object> _returnedObject;
+            runtime::State::ptr _globalState;
+            runtime::State::ptr _localState;
 
+            // Function being executed, along with the state it was called from
+            struct Call
+            {
+                const FunctionNode *function;
+                const runtime::State::ptr *callerState;
+            };
+
+            // Calls being executed, the innermost last, and state of the tail call it returns
+            std::vector<Call> _calls;
+            std::size_t _maxCallDepth;
+            runtime::State::ptr _tailCallState;
+
+            runtime::Object evaluate(const ast::ExpressionNode::ptr &expr);
+            void executeStatements(const std::vector<StatementNode::ptr> &statements);
+
+            runtime::State::ptr bindArguments(
+                CallNode &node,
+                const std::shared_ptr<const FunctionNode> &function,
+                const runtime::State::ptr &parent
+            );
+            bool prepareTailCall(CallNode &node);
+            runtime::Object callBuiltin(CallNode &node, const runtime::Builtin &builtin);
+
+            // Whether the static types of the arguments are those of the parameters, which are as many
+            static bool argumentsMatch(
+                const std::vector<ExpressionNode::ptr> &params,
+                const std::vector<FunctionNode::Param> &namedParams
+            ) noexcept;
+
+            // Variant of an operation on the operands, whose string variant only exists for concatenations
+            static Specialization specializationOf(
+                const runtime::Object &left,
+                const runtime::Object &right,
+                bool concatenates
+            ) noexcept;
+
+            bool completeLoopIteration() noexcept;
+            [[noreturn]] void throwJump();
     };
 };
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <optional>
+
+#include "IVisitor.hpp"
+#include "IntegerNode.hpp"
+#include "StringNode.hpp"
+#include "BinaryNode.hpp"
+#include "ExpressionNode.hpp"
+#include "UnaryNode.hpp"
+#include "LogicalNode.hpp"
+#include "IdentifierNode.hpp"
+
+#include "ExpressionStatementNode.hpp"
+#include "DeclarationNode.hpp"
+#include "AssignmentNode.hpp"
+#include "PrintNode.hpp"
+#include "BlockNode.hpp"
+#include "WhileNode.hpp"
+#include "ConditionNode.hpp"
+#include "ForNode.hpp"
+#include "IncrementNode.hpp"
+
+#include "FunctionNode.hpp"
+#include "ReturnNode.hpp"
+#include "CallNode.hpp"
+
+#include "BreakNode.hpp"
+#include "ContinueNode.hpp"
+
+#include "ProgramNode.hpp"
+
+#include "Object.hpp"
+
+namespace ast
+{
+    // Simplifies a type checked AST in place before it is executed : operations on literals are replaced by their
+    // value, identities such as "x * 1" by their operand and branches under a constant condition are pruned.
+    // Operations which fail are left as is, so their error is raised when they are executed.
+    class FoldVisitor final : public IVisitor
+    {
+        public:
+            FoldVisitor();
+            ~FoldVisitor() final = default;
+
+            void visit(IntegerNode &node) final;
+            void visit(StringNode &node) final;
+            void visit(BinaryNode &node) final;
+            void visit(UnaryNode &node) final;
+            void visit(LogicalNode &node) final;
+            void visit(IdentifierNode &node) final;
+
+            void visit(ExpressionStatementNode &node) final;
+            void visit(DeclarationNode &node) final;
+            void visit(AssignmentNode &node) final;
+            void visit(PrintNode &node) final;
+            void visit(BlockNode &node) final;
+            void visit(WhileNode &node) final;
+            void visit(ConditionNode &node) final;
+            void visit(ForNode &node) final;
+            void visit(IncrementNode &node) final;
+
+            void visit(FunctionNode &node) final;
+            void visit(CallNode &node) final;
+            void visit(ReturnNode &node) final;
+
+            void visit(BreakNode &node) final;
+            void visit(ContinueNode &node) final;
+
+            void visit(ProgramNode &node) final;
+
+        private:
+            // Replacement of the node being visited, if any. A replaced statement may be removed altogether.
+            ExpressionNode::ptr _expression;
+            StatementNode::ptr _statement;
+            bool _replaced;
+
+            ExpressionNode::ptr fold(const ExpressionNode::ptr &expr);
+            StatementNode::ptr fold(const StatementNode::ptr &stmt);
+            StatementNode::ptr foldBranch(const StatementNode::ptr &stmt);
+            std::vector<StatementNode::ptr> fold(const std::vector<StatementNode::ptr> &statements);
+
+            void replace(const runtime::Object &value);
+            void replace(ExpressionNode::ptr expr);
+            void replace(StatementNode::ptr stmt);
+
+            static std::optional<runtime::Object> valueOf(const ExpressionNode::ptr &expr);
+            static std::optional<bool> conditionOf(const ExpressionNode::ptr &expr);
+            static bool isInteger(const ExpressionNode::ptr &expr);
+            static bool isIdentity(Token::Type oprt, Token::Integer value, bool right);
+    };
+};
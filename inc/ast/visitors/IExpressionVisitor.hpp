@@ -0,0 +1,32 @@
+#pragma once
+
+namespace runtime
+{
+    class Object;
+};
+
+namespace ast
+{
+    class IntegerNode;
+    class StringNode;
+    class BinaryNode;
+    class UnaryNode;
+    class LogicalNode;
+    class IdentifierNode;
+    class CallNode;
+
+    // Visitor computing the value of expressions, which is returned rather than kept by the visitor
+    class IExpressionVisitor
+    {
+        public:
+            virtual ~IExpressionVisitor() = default;
+
+            virtual runtime::Object evaluate(IntegerNode &node) = 0;
+            virtual runtime::Object evaluate(StringNode &node) = 0;
+            virtual runtime::Object evaluate(BinaryNode &node) = 0;
+            virtual runtime::Object evaluate(UnaryNode &node) = 0;
+            virtual runtime::Object evaluate(LogicalNode &node) = 0;
+            virtual runtime::Object evaluate(IdentifierNode &node) = 0;
+            virtual runtime::Object evaluate(CallNode &node) = 0;
+    };
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "IVisitor.hpp"
+#include "IntegerNode.hpp"
+#include "StringNode.hpp"
+#include "BinaryNode.hpp"
+#include "ExpressionNode.hpp"
+#include "UnaryNode.hpp"
+#include "LogicalNode.hpp"
+#include "IdentifierNode.hpp"
+
+#include "ExpressionStatementNode.hpp"
+#include "DeclarationNode.hpp"
+#include "AssignmentNode.hpp"
+#include "PrintNode.hpp"
+#include "BlockNode.hpp"
+#include "WhileNode.hpp"
+#include "ConditionNode.hpp"
+#include "ForNode.hpp"
+#include "IncrementNode.hpp"
+
+#include "FunctionNode.hpp"
+#include "ReturnNode.hpp"
+#include "CallNode.hpp"
+
+#include "BreakNode.hpp"
+#include "ContinueNode.hpp"
+
+#include "ProgramNode.hpp"
+
+#include "State.hpp"
+
+namespace ast
+{
+    // Resolves every identifier to the address of its slot, before the AST is executed.
+    // Scopes mirror the states created at runtime : blocks, for loops with an init statement and function parameters.
+    // Calls run in the scope of their caller, so function bodies are resolved on their own : identifiers that are not
+    // declared by the function are looked up by name from the call, unless no local scope declares them, in which case
+    // they belong to the global state. Identifiers that are not declared outside of functions belong to the global
+    // state. Builtins are read through the global slot of their identifier, see runtime::State::load.
+    // The declared type of identifiers is resolved as well, for TypeVisitor.
+    class ResolveVisitor final : public IVisitor
+    {
+        public:
+            explicit ResolveVisitor(runtime::State &globalState);
+            ~ResolveVisitor() final = default;
+
+            void visit(IntegerNode &node) final;
+            void visit(StringNode &node) final;
+            void visit(BinaryNode &node) final;
+            void visit(UnaryNode &node) final;
+            void visit(LogicalNode &node) final;
+            void visit(IdentifierNode &node) final;
+
+            void visit(ExpressionStatementNode &node) final;
+            void visit(DeclarationNode &node) final;
+            void visit(AssignmentNode &node) final;
+            void visit(PrintNode &node) final;
+            void visit(BlockNode &node) final;
+            void visit(WhileNode &node) final;
+            void visit(ConditionNode &node) final;
+            void visit(ForNode &node) final;
+            void visit(IncrementNode &node) final;
+
+            void visit(FunctionNode &node) final;
+            void visit(CallNode &node) final;
+            void visit(ReturnNode &node) final;
+
+            void visit(BreakNode &node) final;
+            void visit(ContinueNode &node) final;
+
+            void visit(ProgramNode &node) final;
+
+        private:
+            // Only declarations executed whenever their scope is, in order, type the identifiers referring to them :
+            // the slot of others may not be set, in which case an outer variable is read instead.
+            // The function is forgotten by the identifiers referring to it once the symbol is reassigned.
+            // Only identifiers outside of functions know it, as calls made after the program may reassign the variables
+            // of a function by name : see visit(ProgramNode) for those made by the program.
+            struct Symbol
+            {
+                std::size_t slot;
+                bool definite;
+                std::optional<Token::Type> type;
+                const FunctionNode *function;
+                std::vector<IdentifierNode *> references;
+            };
+
+            // Functions of global symbols are never known, as programs fed later may reassign them.
+            // The type comes from the definite declaration of the symbol, or from the object of a global identifier.
+            struct Binding
+            {
+                runtime::Address address;
+                std::optional<Token::Type> type;
+                Symbol *symbol;
+            };
+
+            struct Scope
+            {
+                std::unordered_map<std::string, Symbol> symbols;
+                runtime::Layout layout;
+                // Number of enclosing branches when the scope begins
+                std::size_t branches;
+            };
+
+            runtime::State &_globalState;
+            std::vector<Scope> _scopes;
+            std::unordered_map<std::string, Symbol> _globalSymbols;
+            // Global slots of the identifiers declared by the functions being resolved, the innermost last
+            std::vector<std::vector<std::size_t>> _functions;
+            // Number of conditional branches and loop bodies enclosing the statement being resolved
+            std::size_t _branches;
+            // Identifiers referring to a function, checked once every function the program may call is resolved
+            std::vector<IdentifierNode *> _references;
+
+            void resolve(const ExpressionNode::ptr &expr);
+            void resolve(const StatementNode::ptr &stmt);
+            // Statements which may not be executed, or executed repeatedly such as loop bodies
+            void resolveBranch(const StatementNode::ptr &stmt, bool repeated = false);
+
+            Binding lookup(const std::string &identifier);
+            std::size_t declare(const std::string &identifier, Token::Type type, const FunctionNode *function = nullptr);
+
+            // Declares the identifiers a repeated statement declares in the scope it is executed in, before it is
+            // resolved, as the declarations of an iteration are seen by the next ones.
+            void predeclare(const StatementNode &stmt);
+
+            static void forgetFunction(Symbol &symbol);
+
+            // Whether the statement declares an identifier in the scope it is executed in
+            static bool declares(const StatementNode &stmt);
+
+            void beginScope();
+            runtime::Layout endScope();
+    };
+};
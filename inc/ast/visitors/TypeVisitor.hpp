@@ -0,0 +1,89 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "IVisitor.hpp"
+#include "IntegerNode.hpp"
+#include "StringNode.hpp"
+#include "BinaryNode.hpp"
+#include "ExpressionNode.hpp"
+#include "UnaryNode.hpp"
+#include "LogicalNode.hpp"
+#include "IdentifierNode.hpp"
+
+#include "ExpressionStatementNode.hpp"
+#include "DeclarationNode.hpp"
+#include "AssignmentNode.hpp"
+#include "PrintNode.hpp"
+#include "BlockNode.hpp"
+#include "WhileNode.hpp"
+#include "ConditionNode.hpp"
+#include "ForNode.hpp"
+#include "IncrementNode.hpp"
+
+#include "FunctionNode.hpp"
+#include "ReturnNode.hpp"
+#include "CallNode.hpp"
+
+#include "BreakNode.hpp"
+#include "ContinueNode.hpp"
+
+#include "ProgramNode.hpp"
+
+#include "Object.hpp"
+
+namespace ast
+{
+    // Infers the type of every expression of a resolved AST before it is executed, and reports the type errors it
+    // finds as the runtime would. Operations on operands of known types are annotated so they can skip their checks.
+    // Identifiers whose type depends on the execution are left unknown, and checked at runtime.
+    class TypeVisitor final : public IVisitor
+    {
+        public:
+            TypeVisitor();
+            ~TypeVisitor() final = default;
+
+            void visit(IntegerNode &node) final;
+            void visit(StringNode &node) final;
+            void visit(BinaryNode &node) final;
+            void visit(UnaryNode &node) final;
+            void visit(LogicalNode &node) final;
+            void visit(IdentifierNode &node) final;
+
+            void visit(ExpressionStatementNode &node) final;
+            void visit(DeclarationNode &node) final;
+            void visit(AssignmentNode &node) final;
+            void visit(PrintNode &node) final;
+            void visit(BlockNode &node) final;
+            void visit(WhileNode &node) final;
+            void visit(ConditionNode &node) final;
+            void visit(ForNode &node) final;
+            void visit(IncrementNode &node) final;
+
+            void visit(FunctionNode &node) final;
+            void visit(CallNode &node) final;
+            void visit(ReturnNode &node) final;
+
+            void visit(BreakNode &node) final;
+            void visit(ContinueNode &node) final;
+
+            void visit(ProgramNode &node) final;
+
+        private:
+            struct Function
+            {
+                FunctionNode *node;
+                bool returnChecked;
+            };
+
+            // Functions being checked, the innermost last
+            std::vector<Function> _functions;
+
+            std::optional<Token::Type> check(const ExpressionNode::ptr &expr);
+            void check(const StatementNode::ptr &stmt);
+            void checkCondition(const ExpressionNode::ptr &expr);
+
+            static runtime::Object sample(Token::Type type);
+    };
+};
@@ -1,24 +1,68 @@
 #pragma once
 
+#include <istream>
+
 #include "Parser.hpp"
+#include "VirtualMachine.hpp"
+#include "Cache.hpp"
+#include "Output.hpp"
+#include "Builtins.hpp"
 
 class Evaluator
 {
     public:
-        Evaluator(std::ostream &output = std::cout);
+        enum class Mode
+        {
+            TREE_WALKING,
+            BYTECODE
+        };
+
+        // The functions of the standard library are defined in the state enclosing the global state, see
+        // runtime::Builtins::standard
+        Evaluator(std::ostream &output = std::cout, Mode mode = Mode::TREE_WALKING);
         ~Evaluator() = default;
 
-        void feed(const std::string &expression);
+        // Output printed by the expression is flushed before returning, even when it fails.
+        void feed(std::string_view expression);
+
+        // Lexes, parses and executes the input one top-level statement at a time, as it is read. The syntax tree
+        // of a statement is released once it has run, unless it declares a function.
+        void stream(std::istream &input);
+
+        // Runs the chunk cached for the expression if any, or compiles and caches it. Bytecode mode only.
+        void feed(std::string_view expression, const vm::Cache &cache);
 
         [[nodiscard]] Token::Integer getResult() const noexcept;
 
         const ast::EvalVisitor &getVisitor() const noexcept;
 
+        // Forgets the global identifiers. Builtins are kept.
         void clear() noexcept;
 
         const runtime::State &getState() const noexcept;
 
+        [[nodiscard]] Mode getMode() const noexcept;
+
+        // Deeper calls fail with a LogicalError listing the call chain, rather than overflowing the native stack
+        void setMaxCallDepth(std::size_t depth) noexcept;
+        [[nodiscard]] std::size_t getMaxCallDepth() const noexcept;
+
+        // Makes a native function callable by the programs fed next, while no global of the same identifier is
+        // defined. Fails if a builtin of the same identifier is already defined.
+        void define(const runtime::Builtin::ptr &builtin);
+
     private:
+        Mode _mode;
         Parser _parser;
+        runtime::State::ptr _globalState;
+        runtime::Output::ptr _output;
         ast::EvalVisitor _evalVisitor;
-};
\ No newline at end of file
+        vm::VirtualMachine _vm;
+
+        void execute(ast::INode &root);
+        void interpret(std::string_view expression);
+        void streamStatements(std::istream &input);
+
+        vm::Chunk compile(std::string_view expression);
+        void run(const vm::Chunk &chunk);
+};
@@ -11,6 +11,7 @@ set(INCLUDES
     ${PROJECT_ROOT}/inc/ast/nodes
     ${PROJECT_ROOT}/inc/ast/visitors
     ${PROJECT_ROOT}/inc/runtime
+    ${PROJECT_ROOT}/inc/vm
     ${PROJECT_ROOT}/inc/repl
     ${PROJECT_ROOT}/inc/source_file/
 )
\ No newline at end of file
@@ -1,52 +1,61 @@
 #pragma once
 
+#include <array>
 #include <string>
-#include <functional>
+#include <string_view>
+#include <vector>
 
 #include "token.hpp"
 
 class Lexer
 {
     public:
+        // Class of the first character of a lexeme, selecting the function lexing it
+        enum CharClass : uint8_t
+        {
+            OTHER, SPACE, NEWLINE, DIGIT, WORD, QUOTE
+        };
+
         Lexer();
         ~Lexer() = default;
 
-        void feed(const std::string &expression);
+        // Tokens are views into the source, which is not copied : it must outlive the tokens.
+        // A source which isn't complete is only the beginning of the input : lexing stops before a string literal it
+        // doesn't close, since the rest of the input may close it.
+        void feed(std::string_view source, bool complete = true);
+
+        // Size of the beginning of the last fed source which was lexed
+        [[nodiscard]] std::size_t getLexedSize() const noexcept;
 
-        [[nodiscard]] Token::queue &getTokens() noexcept;
+        // Position of the next fed source in the whole input, when it is fed in parts
+        void setPosition(std::size_t line, std::size_t column) noexcept;
+
+        [[nodiscard]] std::vector<Token> &getTokens() noexcept;
 
         [[nodiscard]] std::size_t tokensCount() const noexcept;
 
         void clear() noexcept;
 
     private:
-        using LexerFunction = std::function<bool (std::string::const_iterator &begin)>;
-
-        const std::vector<LexerFunction> _lexerFunctions;
-
-        Token::queue _queue;
+        std::vector<Token> _tokens;
         std::size_t _line;
         std::size_t _column;
 
-        // TODO: iterator
-        std::string _expression;
-
-        bool lex(std::string::const_iterator &begin);
+        std::string_view _source;
+        std::size_t _lexedSize;
 
-        bool lexProgrammingWord(std::string::const_iterator &begin);
-        bool lexIntegerLiteral(std::string::const_iterator &begin);
-        bool lexStringLiteral(std::string::const_iterator &begin);
-        bool lexOperator(std::string::const_iterator &begin);
+        void lexProgrammingWord(std::string_view::const_iterator &begin);
+        void lexIntegerLiteral(std::string_view::const_iterator &begin);
+        bool lexStringLiteral(std::string_view::const_iterator &begin, bool complete);
+        bool lexOperator(std::string_view::const_iterator &begin);
 
 
-        void pushToken(Token::Type t, const std::string &lexeme);
+        void pushToken(Token::Type t, std::string_view lexeme);
         void pushToken(
             Token::Type t,
-            std::string::const_iterator &it,
+            std::string_view::const_iterator &it,
             long lexemeSize
         );
 
-        std::vector<LexerFunction> createLexerFunctions();
-
-        static bool isProgrammingWord(char c);
-};
\ No newline at end of file
+        static CharClass classify(char c) noexcept;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+// Character scanning kernels used by the lexer on long runs of similar characters.
+// They process 16 (SSE2) or 32 (AVX2) bytes at a time when the target supports it, and fall back to a
+// scalar loop otherwise and on the tail of the input.
+namespace scan
+{
+    // First character in [it, end) which isn't a white space other than a line break
+    const char *skipSpaces(const char *it, const char *end) noexcept;
+
+    // First character in [it, end) which can't be part of an identifier or keyword
+    const char *skipWord(const char *it, const char *end) noexcept;
+
+    // First double quote or backslash in [it, end)
+    const char *findQuoteOrBackslash(const char *it, const char *end) noexcept;
+};
@@ -9,7 +9,22 @@ class Parser
         Parser() = default;
         ~Parser() = default;
 
-        void feed(const std::string &expression);
+        void feed(std::string_view expression);
+
+        // Incremental parsing of a source read in parts : open() lexes the part read so far, starting at the
+        // given position, and parseNext() parses its top-level statements one at a time.
+        void open(std::string_view source, std::size_t line, std::size_t column, bool complete);
+
+        // Next top-level statement, null when there is none left, or nullopt when it may go on past the part read
+        // so far. Syntax errors in such statements are only thrown once the source is complete.
+        // A lexical error is thrown once the statements before it are parsed, in place of the statement reaching it.
+        std::optional<ast::StatementNode::ptr> parseNext(bool complete);
+
+        // First token left to parse, null if all were parsed
+        [[nodiscard]] const Token *getPendingToken() const noexcept;
+
+        // Size of the beginning of the opened source whose statements were parsed
+        [[nodiscard]] std::size_t getParsedSize() const noexcept;
 
         [[nodiscard]] const ast::INode::ptr &getAstRoot() const noexcept;
 
@@ -19,10 +34,13 @@ class Parser
     private:
         Lexer _lexer;
         ast::INode::ptr _astRoot;
-        Token::Iterator _tokenItr;
+        Token::Buffer _tokens;
+        std::string_view _source;
+        std::optional<LexicalError> _lexicalError;
 
         ast::ProgramNode::ptr parseProgram();
         ast::StatementNode::ptr parseStatement();
+        ast::StatementNode::ptr parseIdentifierStatement();
         ast::StatementNode::ptr parseExpressionStatement();
         ast::StatementNode::ptr parseDeclarationStatement();
         ast::StatementNode::ptr parseAssignmentStatement();
@@ -44,16 +62,6 @@ class Parser
         ast::StepStatementNode::ptr parseStepStatement();
         ast::StatementNode::ptr parseConditions();
         ast::ExpressionNode::ptr parseExpression();
-        ast::ExpressionNode::ptr parseLogicalOr();
-        ast::ExpressionNode::ptr parseLogicalAnd();
-        ast::ExpressionNode::ptr parseBitwiseOr();
-        ast::ExpressionNode::ptr parseBitwiseXor();
-        ast::ExpressionNode::ptr parseBitwiseAnd();
-        ast::ExpressionNode::ptr parseEquality();
-        ast::ExpressionNode::ptr parseComparison();
-        ast::ExpressionNode::ptr parseBitshift();
-        ast::ExpressionNode::ptr parseTerm();
-        ast::ExpressionNode::ptr parseFactor();
         ast::ExpressionNode::ptr parseUnary();
         ast::ExpressionNode::ptr parseCall();
         std::vector<ast::ExpressionNode::ptr> parseParams();
@@ -63,13 +71,7 @@ class Parser
         ast::ExpressionNode::ptr parseIdentifier();
         ast::ExpressionNode::ptr parseGrouping();
 
-        using ParseFunction = std::function<ast::ExpressionNode::ptr ()>;
-
-        ast::ExpressionNode::ptr parseBinaryExpression(
-            const std::initializer_list<Token::Type> &matchTokens,
-            const ParseFunction &parseSubExpression,
-            bool logical = false
-        );
+        ast::ExpressionNode::ptr parseBinaryExpression(uint8_t minPrecedence);
 
         ast::ExpressionNode::ptr parseParenthesizedExpression(const Token &previousToken);
 
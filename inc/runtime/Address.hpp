@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+namespace runtime
+{
+    // Location of a variable, resolved before execution by ast::ResolveVisitor :
+    // number of scopes to walk up from the current scope, or GLOBAL for the global scope, then index of the variable
+    // in that scope.
+    struct Address
+    {
+        static constexpr std::size_t GLOBAL = std::size_t(-1);
+
+        std::size_t depth = 0;
+        std::size_t slot = 0;
+
+        // Whether the variable is read from a function which doesn't declare it : a scope of one of its callers may
+        // declare it as well, see runtime::State::load.
+        bool dynamic = false;
+    };
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "Object.hpp"
+#include "FunctionNode.hpp"
+
+namespace runtime
+{
+    // A function implemented natively, which programs call like the functions they declare
+    class Builtin final
+    {
+        public:
+            using ptr = std::shared_ptr<const Builtin>;
+
+            // Given arguments of the types of the parameters, returns an object of the return type, or a null object
+            // when the return type is void
+            using Implementation = std::function<Object(std::span<const Object> arguments)>;
+
+            static ptr create(
+                std::string identifier,
+                std::vector<ast::FunctionNode::Param> params,
+                Token::Type returnType,
+                Implementation implementation
+            );
+
+            Builtin(
+                std::string identifier,
+                std::vector<ast::FunctionNode::Param> params,
+                Token::Type returnType,
+                Implementation implementation
+            );
+            ~Builtin() = default;
+
+            [[nodiscard]] const std::string &getIdentifier() const noexcept;
+            [[nodiscard]] const std::vector<ast::FunctionNode::Param> &getParams() const noexcept;
+            [[nodiscard]] Token::Type getReturnType() const noexcept;
+
+            // Arguments and returned object are checked as in calls to declared functions
+            [[nodiscard]] Object call(std::span<const Object> arguments) const;
+
+        private:
+            std::string _identifier;
+            std::vector<ast::FunctionNode::Param> _params;
+            Token::Type _returnType;
+            Implementation _implementation;
+    };
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+
+#include "Builtin.hpp"
+#include "State.hpp"
+
+namespace runtime
+{
+    // Native functions made available to programs, bound before any program is run in a state enclosing the global
+    // state. Globals of the same identifier shadow them while they are defined.
+    // Embedding hosts extend the standard library by adding their own functions.
+    class Builtins final
+    {
+        public:
+            Builtins() = default;
+            ~Builtins() = default;
+
+            // len, substr, min, max, abs, parseInt and toString
+            static Builtins standard();
+
+            // Replaces the function of the same identifier, if any
+            void add(const Builtin::ptr &builtin);
+
+            // Defines every function in the state. Fails if one of their identifiers is already defined.
+            void bind(State &state) const;
+            static void bind(State &state, const Builtin::ptr &builtin);
+
+            [[nodiscard]] const std::vector<Builtin::ptr> &getFunctions() const noexcept;
+
+        private:
+            std::vector<Builtin::ptr> _functions;
+    };
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace runtime
+{
+    // Recycles the memory of the scopes of an execution : states and their slots are allocated in size classes,
+    // and freed blocks are kept to be reused by the next scopes of the same size rather than returned to the heap.
+    // Allocators keep the pool alive, so it is released once the last state is gone.
+    class FramePool final
+    {
+        public:
+            using ptr = std::shared_ptr<FramePool>;
+            static ptr create();
+
+            FramePool() = default;
+            ~FramePool();
+
+            FramePool(const FramePool &) = delete;
+            FramePool &operator=(const FramePool &) = delete;
+
+            void *allocate(std::size_t size, std::size_t alignment);
+            void deallocate(void *memory, std::size_t size, std::size_t alignment) noexcept;
+
+            template<typename T>
+            class Allocator
+            {
+                public:
+                    using value_type = T;
+
+                    explicit Allocator(FramePool::ptr pool) noexcept : _pool(std::move(pool)) {}
+
+                    template<typename U>
+                    Allocator(const Allocator<U> &other) noexcept : _pool(other.getPool()) {}
+
+                    T *allocate(std::size_t n)
+                    {
+                        return static_cast<T *>(this->_pool->allocate(n * sizeof(T), alignof(T)));
+                    }
+
+                    void deallocate(T *memory, std::size_t n) noexcept
+                    {
+                        this->_pool->deallocate(memory, n * sizeof(T), alignof(T));
+                    }
+
+                    [[nodiscard]] const FramePool::ptr &getPool() const noexcept { return this->_pool; }
+
+                    template<typename U>
+                    bool operator==(const Allocator<U> &other) const noexcept { return this->_pool == other.getPool(); }
+
+                private:
+                    FramePool::ptr _pool;
+            };
+
+        private:
+            // Freed blocks are linked through their first bytes
+            struct Block
+            {
+                Block *next;
+            };
+
+            static constexpr std::size_t CLASS_SIZE = alignof(std::max_align_t);
+            static constexpr std::size_t CLASSES_COUNT = 32;
+
+            std::array<Block *, CLASSES_COUNT> _freeBlocks{};
+
+            // Size class of an allocation, or CLASSES_COUNT when it is left to the heap
+            static std::size_t classOf(std::size_t size, std::size_t alignment) noexcept;
+    };
+};
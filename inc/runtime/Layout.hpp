@@ -0,0 +1,11 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace runtime
+{
+    // Identifiers of the slots of a local scope, in slot order, resolved before execution by ast::ResolveVisitor.
+    // States keep the layout of their scope, so identifiers can also be looked up by name, see runtime::State::load.
+    using Layout = std::vector<std::string>;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace runtime
+{
+    // The tree-walking evaluator recurses natively for every call, so programs run on a stack large enough for the
+    // default maximum call depth rather than on the stack of the thread feeding them. The stack is switched to on
+    // the calling thread : a new thread would make every shared pointer of the process count atomically.
+    class NativeStack final
+    {
+        public:
+            // Reserved, its pages are only committed as the recursion reaches them
+            static constexpr std::size_t SIZE = 256 * 1024 * 1024;
+
+            // Left for what runs between two calls, such as the evaluation of nested expressions
+            static constexpr std::size_t RESERVE = 1024 * 1024;
+
+            // Runs the task on a stack of SIZE bytes, or on the current one if it already is. What the task throws
+            // is rethrown to the caller.
+            static void run(const std::function<void()> &task);
+
+            // Whether less than RESERVE bytes remain on the stack being run on
+            [[nodiscard]] static bool exhausted() noexcept;
+    };
+};
@@ -1,13 +1,23 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <optional>
+#include <type_traits>
+#include <variant>
 
 #include "token.hpp"
 #include "FunctionNode.hpp"
 
+namespace vm
+{
+    class Function;
+};
+
 namespace runtime
 {
+    class Builtin;
+
     class Object
     {
         public:
@@ -15,33 +25,73 @@ namespace runtime
             using Evaluator = std::function<const Object &()>;
 
             Object();
-            Object(Token::Type type, std::string identifier = "");
-            Object(Token::Integer i, std::string identifier = "");
-            Object(Token::String s, std::string identifier = "");
-            explicit Object(const ast::FunctionNode &function);
+            Object(Token::Type type);
+            Object(Token::Integer i);
+            Object(Token::String s);
+            Object(std::shared_ptr<const ast::FunctionNode> function);
+            Object(std::shared_ptr<const vm::Function> function);
+            Object(std::shared_ptr<const Builtin> builtin);
+            Object(const Object &other) = default;
+            Object(Object &&other) noexcept = default;
             ~Object() = default;
 
-            [[nodiscard]] const std::string &getIdentifier() const;
-            [[nodiscard]] Token::Type getType() const;
+            [[nodiscard]] Token::Type getType() const noexcept
+            {
+                return this->_type;
+            }
+
+            [[nodiscard]] Token::Integer getInteger() const
+            {
+                if (this->_type != Token::INT_TYPE)
+                    throw InternalError("token type is not integer");
+
+                return *std::get_if<Token::Integer>(&this->_value);
+            }
 
-            [[nodiscard]] Token::Integer getInteger() const;
+            [[nodiscard]] bool isNull() const noexcept
+            {
+                return std::holds_alternative<std::monostate>(this->_value);
+            }
 
             template<typename T>
-            [[nodiscard]] T get() const
+            [[nodiscard]] const T &get() const
             {
-                try {
-                    return std::any_cast<T>(this->_raw);
-                } catch (const std::bad_any_cast &err) {
-                    throw LogicalError(fmt::format("mismatched types : {}", err.what()));
+                if constexpr (std::is_same_v<T, Token::Integer>) {
+                    const auto *value = std::get_if<T>(&this->_value);
+
+                    if (!value)
+                        throw LogicalError("mismatched types");
+
+                    return *value;
+                } else {
+                    const auto *value = std::get_if<std::shared_ptr<const T>>(&this->_value);
+
+                    if (!value)
+                        throw LogicalError("mismatched types");
+
+                    return **value;
                 }
             }
 
+            // Shared value of the object, which outlives the object
+            template<typename T>
+            [[nodiscard]] const std::shared_ptr<const T> &getShared() const
+            {
+                const auto *value = std::get_if<std::shared_ptr<const T>>(&this->_value);
+
+                if (!value)
+                    throw LogicalError("mismatched types");
+
+                return *value;
+            }
+
+            // Shared value of the object if it is a T, null otherwise
             template<typename T>
-            void set(T value)
+            [[nodiscard]] const T *getIf() const noexcept
             {
-                (void)this->get<T>();
+                const auto *value = std::get_if<std::shared_ptr<const T>>(&this->_value);
 
-                this->_raw = value;
+                return value ? value->get() : nullptr;
             }
 
             // Binary operations
@@ -68,8 +118,19 @@ namespace runtime
             Object operator!() const;
             Object operator~() const;
 
+            // Operator of a binary or unary expression, by token type
+            [[nodiscard]] Object apply(Token::Type oprt, const Object &right) const;
+            [[nodiscard]] Object apply(Token::Type oprt) const;
+
+            // Operations on values known to be integers, which skip type checks
+            [[nodiscard]] static Token::Integer apply(Token::Type oprt, Token::Integer left, Token::Integer right);
+            [[nodiscard]] static Token::Integer apply(Token::Type oprt, Token::Integer value);
+            [[nodiscard]] static Token::Integer divide(Token::Integer left, Token::Integer right);
+            [[nodiscard]] static Token::Integer modulo(Token::Integer left, Token::Integer right);
+
             explicit operator bool() const;
             Object &operator=(const Object &other) = default;
+            Object &operator=(Object &&other) noexcept = default;
 
             Object &assign(const Object &other);
 
@@ -77,9 +138,18 @@ namespace runtime
             [[nodiscard]] std::string getValueAsString() const noexcept;
 
         private:
-            std::string _identifier;
+            // Integers are stored inline, other values are shared and immutable so copying an object never allocates.
+            using Value = std::variant<
+                std::monostate,
+                Token::Integer,
+                std::shared_ptr<const Token::String>,
+                std::shared_ptr<const ast::FunctionNode>,
+                std::shared_ptr<const vm::Function>,
+                std::shared_ptr<const Builtin>
+            >;
+
             Token::Type _type;
-            std::any _raw;
+            Value _value;
 
             [[nodiscard]] bool isTypeEqual(Token::Type type) const noexcept;
             [[nodiscard]] bool areTypesEqual(const Object &other, Token::Type type) const noexcept;
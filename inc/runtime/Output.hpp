@@ -0,0 +1,55 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "Object.hpp"
+
+namespace runtime
+{
+    // Buffered sink of the print statements, shared by ast::EvalVisitor and vm::VirtualMachine.
+    // Values are formatted straight into the buffer, which is written to the stream when full, when flushed, and
+    // at the end of each line under the LINE policy.
+    class Output
+    {
+        public:
+            using ptr = std::shared_ptr<Output>;
+
+            enum class FlushPolicy
+            {
+                // Only when the buffer is full or on explicit flushes
+                FULL,
+                // At the end of each line as well, for interactive outputs
+                LINE
+            };
+
+            // Uses the LINE policy when the stream is the standard output connected to a terminal
+            static ptr create(std::ostream &stream = std::cout);
+            static ptr create(std::ostream &stream, FlushPolicy policy);
+
+            Output(std::ostream &stream, FlushPolicy policy);
+            ~Output();
+
+            Output(const Output &) = delete;
+            Output &operator=(const Output &) = delete;
+
+            void write(const Object &object);
+            void write(Token::Integer i);
+            void write(std::string_view s);
+            void endLine();
+
+            void flush();
+
+            [[nodiscard]] FlushPolicy getFlushPolicy() const noexcept;
+
+        private:
+            std::ostream &_stream;
+            FlushPolicy _policy;
+            std::vector<char> _buffer;
+            std::size_t _size;
+
+            char *reserve(std::size_t size);
+    };
+};
@@ -1,34 +1,87 @@
 #pragma once
 
+#include <cstdint>
 #include <unordered_map>
 #include <optional>
+#include <vector>
 
 #include "Object.hpp"
+#include "Address.hpp"
+#include "Layout.hpp"
+#include "FramePool.hpp"
 
 namespace runtime
 {
+    // A scope holding its variables in slots, whose indexes are resolved before execution by ast::ResolveVisitor.
+    // Only the global state keeps track of identifiers, so it can grow across several programs. So does the state of
+    // the builtins enclosing it, see runtime::Builtins. Local states keep the layout of their scope instead.
+    // Calls take the state of their caller as parent, so functions see the variables of the scopes they are called
+    // from. Nested states are allocated in the pool of the global state they descend from.
     class State
     {
         public:
             using ptr = std::shared_ptr<State>;
 
-            static ptr create(const ptr& parent = nullptr);
-            explicit State();
-            explicit State(ptr parent);
+            // How local scopes use a global identifier, registered in the global state by ast::ResolveVisitor
+            enum Usage : uint8_t
+            {
+                // Declared by a local scope, which may then shadow the global for the functions it calls
+                DECLARED_LOCALLY = 1,
+                // Looked up by name from a function, which may find it in the scope of one of its callers
+                LOOKED_UP = 2,
+                // Assigned by name, from a function or a scope whose declaration may not be executed, which may then
+                // replace the variable of an enclosing scope
+                ASSIGNED_BY_NAME = 4
+            };
+
+            // Global state, enclosed by the parent if any
+            static ptr create(const ptr &parent = nullptr);
+            // State of a local scope, whose layout outlives it
+            static ptr create(const ptr &parent, const Layout &layout);
+            State(ptr parent, const Layout *layout, const FramePool::ptr &pool);
             ~State();
 
             [[nodiscard]] std::optional<Object> get(const std::string &identifier) const noexcept;
+            std::size_t resolve(const std::string &identifier);
+
+            // Slots of the global identifiers
+            [[nodiscard]] const std::unordered_map<std::string, std::size_t> &getSymbols() const noexcept;
+
+            // A slot which isn't set falls back to the innermost variable of the same identifier, looked up by name
+            // from this state as the identifier may be declared later or conditionally in its scope, or by a caller.
+            [[nodiscard]] Object& find(const Address &address, const std::string &identifier);
 
-            [[nodiscard]] Object& find(const std::string &identifier);
-            [[nodiscard]] std::optional<std::reference_wrapper<Object>> tryFind(const std::string &identifier) noexcept;
-            void set(const std::string &identifier, const Object &object);
+            // Like find, except that a global which isn't defined falls back to the builtin of the same identifier
+            [[nodiscard]] const Object& load(const Address &address, const std::string &identifier);
+            void set(std::size_t slot, const std::string &identifier, const Object &object);
+
+            void use(std::size_t slot, uint8_t usage);
+            [[nodiscard]] uint8_t getUsage(std::size_t slot) const noexcept;
+            // Whether a function may look up any of the global identifiers of the slots
+            [[nodiscard]] bool isLookedUp(const std::vector<std::size_t> &slots) const noexcept;
 
             void clear() noexcept;
 
             ptr restoreParent();
+            [[nodiscard]] const ptr &getParent() const noexcept;
+
+            [[nodiscard]] FramePool::ptr getPool() const noexcept;
 
         private:
-            std::unordered_map<std::string, Object::ptr> _state;
+            std::vector<Object, FramePool::Allocator<Object>> _slots;
+            std::unordered_map<std::string, std::size_t> _symbols;
             ptr _parent;
+            // Null for the global state
+            const Layout *_layout;
+            State *_global;
+            // Usages of the global identifiers, indexed by their slot
+            std::vector<uint8_t> _usages;
+            // Slots of the builtins found by load in the parent state, indexed by the slot of the global
+            std::vector<std::size_t> _builtinSlots;
+
+            State &ancestor(std::size_t depth);
+            Object *lookup(const Address &address, const std::string &identifier);
+            Object *search(const std::string &identifier) noexcept;
+            const Object &loadBuiltin(std::size_t slot, const std::string &identifier);
     };
-};
\ No newline at end of file
+};
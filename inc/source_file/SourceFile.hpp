@@ -1,6 +1,7 @@
 #pragma once
 
-#include <fstream>
+#include <string>
+#include <string_view>
 
 #include "Evaluator.hpp"
 
@@ -9,13 +10,26 @@ class SourceFile
     public:
 
         SourceFile(const std::string &filePath);
-        ~SourceFile() = default;
+        ~SourceFile();
+
+        SourceFile(const SourceFile &) = delete;
+        SourceFile &operator=(const SourceFile &) = delete;
 
         void interpret(Evaluator &evaluator);
 
+        // Same as interpret, loading the compiled script from the cache when it is unchanged
+        void interpretCached(Evaluator &evaluator);
+
     private:
         std::string _filePath;
-        std::string _sourceContent;
 
-        static std::string readFile(const std::string &filePath);
-};
\ No newline at end of file
+        // Regular files are mapped read-only, other files like pipes are read into the buffer
+        void *_mapping;
+        std::size_t _mappingSize;
+        std::string _buffer;
+
+        std::string_view _sourceContent;
+
+        void readFile();
+        void readStream(int fd);
+};
@@ -1,12 +1,12 @@
 #pragma once
 
 #include <cstdint>
-#include <queue>
 #include <memory>
 #include <string>
-#include <any>
+#include <string_view>
 #include <initializer_list>
 #include <optional>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -56,33 +56,23 @@ class Token
         using String = std::string;
 
     public:
-        using ptr = std::shared_ptr<Token>;
-
-        static ptr create(Token::Type type, const std::string &lexeme, std::size_t line, std::size_t column);
-
-        Token(Token::Type type, const std::string &lexeme, std::size_t line = 0, std::size_t column = 0);
+        // The lexeme is a view into the lexed source, which must outlive the token.
+        // Literal values are decoded from it when requested.
+        Token(Token::Type type, std::string_view lexeme, std::size_t line = 0, std::size_t column = 0);
 
         [[nodiscard]] Type getType() const noexcept;
 
         [[nodiscard]] bool isType(Token::Type type) const noexcept;
-        [[nodiscard]] bool isTypeAnyOf(const std::initializer_list<Token::Type> &types);
+        [[nodiscard]] bool isTypeAnyOf(const std::initializer_list<Token::Type> &types) const;
 
         [[nodiscard]] static bool isTypeAnyOf(Token::Type type, const std::initializer_list<Token::Type> &types);
 
         static std::string typeToString(Type type);
 
-        template<typename T>
-        [[nodiscard]] T getLiteral() const
-        {
-            try {
-                return std::any_cast<T>(this->_literalValue);
-            } catch (const std::bad_any_cast &err) {
-                throw InternalError(fmt::format("mismatched types : {}", err.what()));
-            }
-        }
         [[nodiscard]] Integer getIntegerLiteral() const;
+        [[nodiscard]] String getStringLiteral() const;
 
-        [[nodiscard]] const std::string &getLexeme() const noexcept;
+        [[nodiscard]] std::string_view getLexeme() const noexcept;
         [[nodiscard]] std::size_t getLine() const noexcept;
         [[nodiscard]] std::size_t getColumn() const noexcept;
 
@@ -92,39 +82,52 @@ class Token
         bool isAssignableOperator() const noexcept;
         static bool isAssignableOperator(Token::Type type) noexcept;
 
+        // Binary operator applied by a compound assignment operator, such as PLUS for PLUS_GN
+        static Token::Type compoundOperator(Token::Type type);
+
+        static Integer integerFromLexeme(std::string_view lexeme);
+        static String stringFromLexeme(std::string_view lexeme);
+
     private:
         Type _type;
-        std::string _lexeme;
-        std::any _literalValue;
-        std::size_t _line;
-        std::size_t _column;
-
-        static std::any literalFromLexeme(Token::Type type, const std::string &lexeme);
-        static Integer integerFromLexeme(const std::string &lexeme);
-        static String stringFromLexeme(const std::string &lexeme);
+        uint32_t _line;
+        uint32_t _column;
+        std::string_view _lexeme;
 
     public:
-        using queue = std::queue<ptr>;
-
-        class Iterator
+        // Random access buffer of the lexed tokens, read through a cursor.
+        // Tokens are returned by address, null when out of the buffer.
+        class Buffer
         {
             public:
-                Iterator() = default;
-                Iterator(Token::queue tokens);
-                ~Iterator() = default;
+                Buffer() = default;
+                explicit Buffer(std::vector<Token> tokens);
+                ~Buffer() = default;
+
+                // Takes over the given tokens, leaving the vector empty.
+                Buffer &reset(std::vector<Token> &tokens);
+
+                [[nodiscard]] const Token *get() const noexcept;
+                [[nodiscard]] const Token *next() const noexcept;
+                [[nodiscard]] const Token *prev() const noexcept;
+
+                // Token at the given offset from the cursor
+                [[nodiscard]] const Token *peek(long offset) const noexcept;
 
-                Iterator &reset(Token::queue &tokens);
+                Buffer &advance(std::size_t count = 1);
 
-                [[nodiscard]] std::optional<Token> get() const noexcept;
-                [[nodiscard]] std::optional<Token> next() const noexcept;
-                [[nodiscard]] std::optional<Token> prev() const noexcept;
+                // Cursor position, to backtrack to with rewind()
+                [[nodiscard]] std::size_t mark() noexcept;
+                void rewind(std::size_t position) noexcept;
 
-                Iterator &advance();
+                // Whether a token past the end of the buffer was requested since the last mark()
+                [[nodiscard]] bool isExhausted() const noexcept;
 
+                [[nodiscard]] std::size_t size() const noexcept;
 
             private:
-                Token::queue _tokens;
-                Token::ptr _current;
-                Token::ptr _prev;
+                std::vector<Token> _tokens;
+                std::size_t _index = 0;
+                mutable bool _exhausted = false;
         };
 };
\ No newline at end of file
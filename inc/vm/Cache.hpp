@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Chunk.hpp"
+#include "State.hpp"
+
+#define CACHE_DIR_VARIABLE ("HUDSON_CACHE_DIR")
+
+namespace vm
+{
+    // Chunks compiled from scripts, stored on disk so unchanged scripts are not lexed, parsed and compiled again.
+    // An entry is only loaded when both the hash of the source and the interpreter version match.
+    class Cache
+    {
+        public:
+            explicit Cache(std::filesystem::path path);
+            ~Cache() = default;
+
+            // Entry of the given source in the directory named by $HUDSON_CACHE_DIR, or next to the source file
+            static Cache locate(const std::string &sourcePath, std::string_view source);
+
+            // Chunk compiled from the source, registering the global identifiers it uses, along with how local scopes
+            // use them, in an empty global state.
+            // Empty when the entry is missing, stale or unreadable, or the global state isn't empty.
+            [[nodiscard]] std::optional<Chunk> load(std::string_view source, runtime::State &globalState) const;
+
+            // Writes the entry atomically. Caching is best effort : failures are ignored.
+            void store(std::string_view source, const Chunk &chunk, const runtime::State &globalState) const noexcept;
+
+            [[nodiscard]] const std::filesystem::path &getPath() const noexcept;
+
+            [[nodiscard]] static uint64_t hash(std::string_view source) noexcept;
+
+        private:
+            std::filesystem::path _path;
+    };
+};
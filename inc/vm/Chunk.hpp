@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Object.hpp"
+#include "Address.hpp"
+#include "Layout.hpp"
+
+namespace vm
+{
+    class Function;
+
+    class Chunk
+    {
+        public:
+            enum OpCode : uint8_t
+            {
+                // Values
+                INTEGER, CONSTANT, LOAD, POP,
+
+                // Declarations
+                DECLARE, DECLARE_ASSIGN, ASSIGN, INCREMENT, FUNCTION,
+
+                // Scopes
+                ENTER_SCOPE, EXIT_SCOPE,
+
+                // Binary operations
+                MOD, DIV, MULT,
+                ADD, SUB,
+                GT, GTE, LT, LTE,
+                EQUAL, NOT_EQUAL,
+                BITWISE_AND, BITWISE_OR, BITWISE_XOR,
+                BITWISE_LSHIFT, BITWISE_RSHIFT,
+
+                // Unary operations
+                POSITIVE, NEGATIVE, NOT, BITWISE_NOT,
+
+                // Logical operations
+                AND, OR, BOOL,
+
+                // Control flow
+                JUMP, JUMP_IF_FALSE,
+                CALL, TAIL_CALL, RETURN,
+                INVALID_JUMP,
+
+                PRINT
+            };
+
+            // Argument of binary and unary operation instructions, whether TypeVisitor knows the operands are integers
+            enum OperandKind : uint8_t
+            {
+                OPERANDS_ANY, OPERANDS_INTEGER
+            };
+
+            // Argument of CALL and TAIL_CALL instructions, whether TypeVisitor knows the arguments match the parameters
+            enum CallKind : uint8_t
+            {
+                CALL_CHECKED, CALL_UNCHECKED
+            };
+
+            // Argument of a RETURN instruction
+            enum ReturnKind : uint8_t
+            {
+                RETURN_NOTHING, RETURN_VALUE, RETURN_IMPLICIT
+            };
+
+            // Argument of an INVALID_JUMP instruction
+            enum JumpKind : uint8_t
+            {
+                JUMP_BREAK, JUMP_CONTINUE, JUMP_RETURN
+            };
+
+            struct Instruction
+            {
+                OpCode opcode;
+                uint8_t arg;
+                uint32_t operand;
+            };
+
+            // Operand of LOAD, DECLARE, DECLARE_ASSIGN, ASSIGN and INCREMENT instructions
+            struct Variable
+            {
+                std::string identifier;
+                runtime::Address address;
+            };
+
+            using ptr = std::shared_ptr<Chunk>;
+
+            Chunk() = default;
+            ~Chunk() = default;
+
+            std::size_t emit(OpCode opcode, uint32_t operand = 0, uint8_t arg = 0);
+            void patch(std::size_t index, uint32_t operand);
+
+            [[nodiscard]] std::size_t size() const noexcept;
+
+            uint32_t addConstant(const runtime::Object &object);
+            uint32_t addVariable(const std::string &identifier, const runtime::Address &address);
+            uint32_t addFunction(const std::shared_ptr<const Function> &function);
+            // Operand of ENTER_SCOPE instructions
+            uint32_t addLayout(runtime::Layout layout);
+
+            [[nodiscard]] const std::vector<Instruction> &getCode() const noexcept;
+            [[nodiscard]] const std::vector<runtime::Object> &getConstants() const noexcept;
+            [[nodiscard]] const std::vector<Variable> &getVariables() const noexcept;
+            [[nodiscard]] const std::vector<std::shared_ptr<const Function>> &getFunctions() const noexcept;
+            [[nodiscard]] const std::vector<runtime::Layout> &getLayouts() const noexcept;
+
+        private:
+            std::vector<Instruction> _code;
+            std::vector<runtime::Object> _constants;
+            std::vector<Variable> _variables;
+            std::vector<std::shared_ptr<const Function>> _functions;
+            std::vector<runtime::Layout> _layouts;
+    };
+};
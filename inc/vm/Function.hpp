@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+
+#include "Chunk.hpp"
+#include "FunctionNode.hpp"
+
+namespace vm
+{
+    class Function
+    {
+        public:
+            using ptr = std::shared_ptr<const Function>;
+            static ptr create(
+                const ast::FunctionNode &node,
+                Chunk chunk
+            );
+
+            Function(
+                std::string identifier,
+                std::vector<ast::FunctionNode::Param> params,
+                Token::Type returnType,
+                std::size_t slot,
+                runtime::Layout frame,
+                std::vector<std::size_t> locals,
+                Chunk chunk
+            );
+            ~Function() = default;
+
+            [[nodiscard]] const std::string &getIdentifier() const noexcept;
+            [[nodiscard]] const std::vector<ast::FunctionNode::Param> &getParams() const noexcept;
+            [[nodiscard]] Token::Type getReturnType() const noexcept;
+            [[nodiscard]] std::size_t getSlot() const noexcept;
+            // See ast::FunctionNode
+            [[nodiscard]] const runtime::Layout &getFrame() const noexcept;
+            [[nodiscard]] const std::vector<std::size_t> &getLocals() const noexcept;
+            [[nodiscard]] const Chunk &getChunk() const noexcept;
+
+        private:
+            std::string _identifier;
+            std::vector<ast::FunctionNode::Param> _params;
+            Token::Type _returnType;
+            std::size_t _slot;
+            runtime::Layout _frame;
+            std::vector<std::size_t> _locals;
+            Chunk _chunk;
+    };
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+
+#include "Chunk.hpp"
+#include "Function.hpp"
+#include "State.hpp"
+#include "Output.hpp"
+
+namespace vm
+{
+    // Stack based virtual machine executing chunks produced by ast::CompileVisitor.
+    class VirtualMachine
+    {
+        public:
+            explicit VirtualMachine(
+                runtime::Output::ptr output = runtime::Output::create(),
+                runtime::State::ptr globalState = runtime::State::create()
+            );
+            ~VirtualMachine() = default;
+
+            void run(const Chunk &chunk);
+
+            [[nodiscard]] const runtime::Object &value() const noexcept;
+            [[nodiscard]] Token::Integer getResult() const;
+
+            [[nodiscard]] const runtime::State &getState() const noexcept;
+
+            void clearState() noexcept;
+
+            // Same limit as ast::EvalVisitor, so that both modes fail alike
+            void setMaxCallDepth(std::size_t depth) noexcept;
+            [[nodiscard]] std::size_t getMaxCallDepth() const noexcept;
+
+        private:
+            struct Frame
+            {
+                Function::ptr function;
+                const Chunk *chunk;
+                std::size_t ip;
+                runtime::State::ptr callerState;
+            };
+
+            runtime::Output::ptr _output;
+            std::vector<runtime::Object> _stack;
+            std::vector<Frame> _frames;
+            runtime::Object _result;
+            runtime::State::ptr _globalState;
+            runtime::State::ptr _localState;
+            std::size_t _maxCallDepth;
+
+            void execute();
+
+            // Whether a frame was pushed for the call
+            bool call(uint32_t argc, Chunk::CallKind kind);
+            bool tailCall(uint32_t argc, Chunk::CallKind kind);
+            runtime::State::ptr bindArguments(
+                const Function &function,
+                const runtime::State::ptr &parent,
+                uint32_t argc,
+                Chunk::CallKind kind
+            );
+            bool ret(Chunk::ReturnKind kind);
+
+            // Whether the value of the call the frame is making is used, see ast::CallNode::isValueUsed
+            static bool usesValue(const Frame &caller) noexcept;
+
+            runtime::Object pop();
+            runtime::Object &top();
+    };
+};
@@ -1,29 +1,108 @@
+#include <charconv>
+#include <fstream>
+#include <optional>
 #include <fmt/printf.h>
 
 #include "SourceFile.hpp"
 #include "repl.hpp"
 
+#define BYTECODE_FLAG ("--bytecode")
+#define CACHE_FLAG ("--cache")
+#define STREAM_FLAG ("--stream")
+#define MAX_CALL_DEPTH_FLAG ("--max-call-depth")
+
 void runInteractiveMode()
 {
     Repl repl;
     repl.run();
 }
 
-void runFileMode(const std::string &filePath)
+void runFileMode(const std::string &filePath, Evaluator::Mode mode, bool cache, std::size_t maxCallDepth)
 {
     SourceFile source(filePath);
-    Evaluator evaluator;
+    Evaluator evaluator(std::cout, mode);
+
+    evaluator.setMaxCallDepth(maxCallDepth);
+
+    if (cache)
+        source.interpretCached(evaluator);
+    else
+        source.interpret(evaluator);
+}
+
+void runStreamMode(const std::string &filePath, Evaluator::Mode mode, std::size_t maxCallDepth)
+{
+    Evaluator evaluator(std::cout, mode);
 
-    source.interpret(evaluator);
+    evaluator.setMaxCallDepth(maxCallDepth);
+
+    if (filePath.empty())
+        return evaluator.stream(std::cin);
+
+    std::ifstream input(filePath, std::ios::binary);
+
+    if (!input)
+        throw InterpreterError("FileSystem", fmt::format("failed to open {}", filePath));
+
+    try {
+        evaluator.stream(input);
+    } catch (const InterpreterError &err) {
+        std::string path(filePath);
+        throw InterpreterError(path, err);
+    }
+}
+
+std::optional<std::size_t> parseMaxCallDepth(std::string_view value)
+{
+    std::size_t depth = 0;
+    auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), depth);
+
+    if (error != std::errc() || end != value.data() + value.size())
+        return std::nullopt;
+
+    return depth;
 }
 
 int main(int ac, char **av)
 {
+    auto mode = Evaluator::Mode::TREE_WALKING;
+    bool cache = false;
+    bool stream = false;
+    auto maxCallDepth = ast::EvalVisitor::DEFAULT_MAX_CALL_DEPTH;
+    int arg = 1;
+
+    for (; arg < ac; arg++) {
+        std::string flag(av[arg]);
+
+        if (flag == BYTECODE_FLAG) {
+            mode = Evaluator::Mode::BYTECODE;
+        } else if (flag == CACHE_FLAG) {
+            // Cached scripts are stored as bytecode
+            mode = Evaluator::Mode::BYTECODE;
+            cache = true;
+        } else if (flag == STREAM_FLAG) {
+            stream = true;
+        } else if (flag == MAX_CALL_DEPTH_FLAG && arg + 1 < ac) {
+            auto depth = parseMaxCallDepth(av[++arg]);
+
+            if (!depth) {
+                fmt::print(stderr, "Error : {}: invalid depth \"{}\".\n", MAX_CALL_DEPTH_FLAG, av[arg]);
+                return 1;
+            }
+
+            maxCallDepth = *depth;
+        } else {
+            break;
+        }
+    }
+
     try {
-        if (ac < 2)
+        if (stream)
+            runStreamMode(arg < ac ? std::string(av[arg]) : std::string(), mode, maxCallDepth);
+        else if (arg >= ac)
             runInteractiveMode();
         else
-            runFileMode(std::string(av[1]));
+            runFileMode(std::string(av[arg]), mode, cache, maxCallDepth);
 
     } catch (const std::exception &err) {
         fmt::print(stderr, "Error : {}\n", err.what());
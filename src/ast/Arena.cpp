@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <cstdint>
+
+#include "Arena.hpp"
+
+#define ARENA_FIRST_BLOCK_SIZE (4 * 1024)
+#define ARENA_MAX_BLOCK_SIZE (256 * 1024)
+
+thread_local ast::Arena *ast::Arena::_current = nullptr;
+
+ast::Arena::ptr ast::Arena::create()
+{
+    return std::make_shared<Arena>();
+}
+
+void *ast::Arena::allocate(std::size_t size, std::size_t alignment)
+{
+    auto address = reinterpret_cast<std::uintptr_t>(this->_head);
+    auto padding = (alignment - address % alignment) % alignment;
+
+    if (!this->_head || std::size_t(this->_end - this->_head) < padding + size) {
+        this->grow(size + alignment);
+
+        address = reinterpret_cast<std::uintptr_t>(this->_head);
+        padding = (alignment - address % alignment) % alignment;
+    }
+
+    auto *memory = this->_head + padding;
+
+    this->_head = memory + size;
+
+    return memory;
+}
+
+void ast::Arena::grow(std::size_t size)
+{
+    // Blocks double in size, so small programs like REPL lines stay small
+    auto blockSize = std::clamp<std::size_t>(this->_capacity, ARENA_FIRST_BLOCK_SIZE, ARENA_MAX_BLOCK_SIZE);
+
+    blockSize = std::max(blockSize, size);
+
+    this->_blocks.push_back(std::make_unique<std::byte[]>(blockSize));
+    this->_head = this->_blocks.back().get();
+    this->_end = this->_head + blockSize;
+    this->_capacity += blockSize;
+}
+
+std::size_t ast::Arena::capacity() const noexcept
+{
+    return this->_capacity;
+}
+
+ast::Arena::Scope::Scope(ast::Arena &arena) noexcept
+:   _previous(Arena::_current)
+{
+    Arena::_current = &arena;
+}
+
+ast::Arena::Scope::~Scope()
+{
+    Arena::_current = this->_previous;
+}
@@ -9,7 +9,8 @@ ast::AssignmentNode::AssignmentNode(
 )
 :   _identifier(std::move(identifier)),
     _expression(std::move(expression)),
-    _op(op)
+    _op(op),
+    _specialization(Specialization::UNSPECIALIZED)
 {
     if (!Token::isAssignableOperator(op))
         throw InternalError("AssignmentNode ctor : expecting ASSIGN or an assignable operator");
@@ -35,10 +36,45 @@ ast::AssignmentNode::ptr ast::AssignmentNode::create(
     const ast::ExpressionNode::ptr &expression,
     Token::Type op
 ) {
-    return std::make_shared<AssignmentNode>(identifier, expression, op);
+    return Arena::make<AssignmentNode>(identifier, expression, op);
 }
 
 Token::Type ast::AssignmentNode::getOperator() const
 {
     return this->_op;
 }
+
+void ast::AssignmentNode::setAddress(const runtime::Address &address) noexcept
+{
+    this->_address = address;
+}
+
+const runtime::Address &ast::AssignmentNode::getAddress() const noexcept
+{
+    return this->_address;
+}
+
+void ast::AssignmentNode::setExpression(ast::ExpressionNode::ptr expression) noexcept
+{
+    this->_expression = std::move(expression);
+}
+
+void ast::AssignmentNode::setTargetType(std::optional<Token::Type> type) noexcept
+{
+    this->_targetType = type;
+}
+
+std::optional<Token::Type> ast::AssignmentNode::getTargetType() const noexcept
+{
+    return this->_targetType;
+}
+
+void ast::AssignmentNode::specialize(ast::Specialization specialization) noexcept
+{
+    this->_specialization = specialization;
+}
+
+ast::Specialization ast::AssignmentNode::getSpecialization() const noexcept
+{
+    return this->_specialization;
+}
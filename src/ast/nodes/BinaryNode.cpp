@@ -1,4 +1,5 @@
 #include "BinaryNode.hpp"
+#include "Object.hpp"
 
 #include <utility>
 
@@ -19,7 +20,8 @@ ast::BinaryNode::BinaryNode(
 )
 :   _operator(oprt),
     _leftChild(std::move(left)),
-    _rightChild(std::move(right))
+    _rightChild(std::move(right)),
+    _specialization(Specialization::UNSPECIALIZED)
 {
     if (!Token::isTypeAnyOf(oprt, binaryOperators))
         throw InternalError("BinaryNode: not an operator");
@@ -30,6 +32,11 @@ void ast::BinaryNode::accept(ast::IVisitor &visitor)
     visitor.visit(*this);
 }
 
+runtime::Object ast::BinaryNode::evaluate(ast::IExpressionVisitor &visitor)
+{
+    return visitor.evaluate(*this);
+}
+
 Token::Type ast::BinaryNode::getOperator() const
 {
     return this->_operator;
@@ -51,5 +58,25 @@ ast::BinaryNode::ptr ast::BinaryNode::create(
     const ast::ExpressionNode::ptr& right
 )
 {
-    return std::make_shared<ast::BinaryNode>(oprt, left, right);
+    return Arena::make<ast::BinaryNode>(oprt, left, right);
+}
+
+void ast::BinaryNode::setLeftChild(ast::ExpressionNode::ptr child) noexcept
+{
+    this->_leftChild = std::move(child);
+}
+
+void ast::BinaryNode::setRightChild(ast::ExpressionNode::ptr child) noexcept
+{
+    this->_rightChild = std::move(child);
+}
+
+void ast::BinaryNode::specialize(ast::Specialization specialization) noexcept
+{
+    this->_specialization = specialization;
+}
+
+ast::Specialization ast::BinaryNode::getSpecialization() const noexcept
+{
+    return this->_specialization;
 }
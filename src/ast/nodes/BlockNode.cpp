@@ -1,12 +1,14 @@
 #include "BlockNode.hpp"
 
-ast::BlockNode::ptr ast::BlockNode::create(const std::list<StatementNode::ptr> &statements)
+#include <utility>
+
+ast::BlockNode::ptr ast::BlockNode::create(std::vector<StatementNode::ptr> statements)
 {
-    return std::make_shared<BlockNode>(statements);
+    return Arena::make<BlockNode>(std::move(statements));
 }
 
-ast::BlockNode::BlockNode(std::list<StatementNode::ptr> statements)
-: _statements(std::move(statements))
+ast::BlockNode::BlockNode(std::vector<StatementNode::ptr> statements)
+: _statements(std::move(statements)), _layout(), _scoped(true)
 {}
 
 void ast::BlockNode::accept(ast::IVisitor &visitor)
@@ -14,7 +16,32 @@ void ast::BlockNode::accept(ast::IVisitor &visitor)
     visitor.visit(*this);
 }
 
-const std::list<ast::StatementNode::ptr> &ast::BlockNode::getStatements() const
+const std::vector<ast::StatementNode::ptr> &ast::BlockNode::getStatements() const
 {
     return this->_statements;
 }
+
+void ast::BlockNode::setLayout(runtime::Layout layout) noexcept
+{
+    this->_layout = std::move(layout);
+}
+
+const runtime::Layout &ast::BlockNode::getLayout() const noexcept
+{
+    return this->_layout;
+}
+
+void ast::BlockNode::setScoped(bool scoped) noexcept
+{
+    this->_scoped = scoped;
+}
+
+bool ast::BlockNode::isScoped() const noexcept
+{
+    return this->_scoped;
+}
+
+void ast::BlockNode::setStatements(std::vector<ast::StatementNode::ptr> statements) noexcept
+{
+    this->_statements = std::move(statements);
+}
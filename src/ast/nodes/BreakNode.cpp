@@ -2,7 +2,7 @@
 
 ast::BreakNode::ptr ast::BreakNode::create()
 {
-    return std::make_shared<BreakNode>();
+    return Arena::make<BreakNode>();
 }
 
 void ast::BreakNode::accept(ast::IVisitor &visitor)
@@ -1,4 +1,5 @@
 #include "CallNode.hpp"
+#include "Object.hpp"
 
 #include <utility>
 
@@ -7,14 +8,20 @@ ast::CallNode::ptr ast::CallNode::create(
     const std::vector<ast::ExpressionNode::ptr> &params
 )
 {
-    return std::make_shared<CallNode>(callee, params);
+    return Arena::make<CallNode>(callee, params);
 }
 
 ast::CallNode::CallNode(
     ast::ExpressionNode::ptr callee,
     const std::vector<ast::ExpressionNode::ptr> &params
 ):  _callee(std::move(callee)),
-    _params(params)
+    _params(params),
+    _checked(false),
+    _tailCall(false),
+    _valueUsed(true),
+    _cachedFunction(),
+    _cachedAddress(nullptr),
+    _cacheChecked(false)
 {
 }
 
@@ -23,6 +30,11 @@ void ast::CallNode::accept(ast::IVisitor &visitor)
     visitor.visit(*this);
 }
 
+runtime::Object ast::CallNode::evaluate(ast::IExpressionVisitor &visitor)
+{
+    return visitor.evaluate(*this);
+}
+
 const ast::ExpressionNode::ptr &ast::CallNode::getCallee() const
 {
     return this->_callee;
@@ -32,3 +44,56 @@ const std::vector<ast::ExpressionNode::ptr> &ast::CallNode::getParams() const
 {
     return this->_params;
 }
+
+void ast::CallNode::setParam(std::size_t index, ast::ExpressionNode::ptr param) noexcept
+{
+    this->_params[index] = std::move(param);
+}
+
+void ast::CallNode::setChecked(bool checked) noexcept
+{
+    this->_checked = checked;
+}
+
+bool ast::CallNode::isChecked() const noexcept
+{
+    return this->_checked;
+}
+
+void ast::CallNode::setTailCall(bool tailCall) noexcept
+{
+    this->_tailCall = tailCall;
+}
+
+bool ast::CallNode::isTailCall() const noexcept
+{
+    return this->_tailCall;
+}
+
+void ast::CallNode::setValueUsed(bool valueUsed) noexcept
+{
+    this->_valueUsed = valueUsed;
+}
+
+bool ast::CallNode::isValueUsed() const noexcept
+{
+    return this->_valueUsed;
+}
+
+void ast::CallNode::cache(const std::shared_ptr<const ast::FunctionNode> &function, bool checked)
+{
+    this->_cachedFunction = function;
+    this->_cachedAddress = function.get();
+    this->_cacheChecked = checked;
+}
+
+bool ast::CallNode::isCached(const ast::FunctionNode &function) const noexcept
+{
+    // An expired function may have left its address to another one
+    return &function == this->_cachedAddress && !this->_cachedFunction.expired();
+}
+
+bool ast::CallNode::isCacheChecked() const noexcept
+{
+    return this->_cacheChecked;
+}
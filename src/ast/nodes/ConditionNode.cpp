@@ -5,7 +5,7 @@ ast::ConditionNode::ptr ast::ConditionNode::create(
     const ast::StatementNode::ptr &ifBranch,
     const ast::StatementNode::ptr &elseBranch
 ) {
-    return std::make_shared<ConditionNode>(expression, ifBranch, elseBranch);
+    return Arena::make<ConditionNode>(expression, ifBranch, elseBranch);
 }
 
 ast::ConditionNode::ConditionNode(
@@ -37,3 +37,18 @@ const ast::StatementNode::ptr &ast::ConditionNode::getElseBranch() const
 {
     return this->_elseBranch;
 }
+
+void ast::ConditionNode::setExpression(ast::ExpressionNode::ptr expression) noexcept
+{
+    this->_expr = std::move(expression);
+}
+
+void ast::ConditionNode::setIfBranch(ast::StatementNode::ptr branch) noexcept
+{
+    this->_ifBranch = std::move(branch);
+}
+
+void ast::ConditionNode::setElseBranch(ast::StatementNode::ptr branch) noexcept
+{
+    this->_elseBranch = std::move(branch);
+}
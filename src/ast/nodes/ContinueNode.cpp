@@ -2,7 +2,7 @@
 
 ast::ContinueNode::ptr ast::ContinueNode::create()
 {
-    return std::make_shared<ContinueNode>();
+    return Arena::make<ContinueNode>();
 }
 
 void ast::ContinueNode::accept(ast::IVisitor &visitor)
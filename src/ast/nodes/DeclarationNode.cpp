@@ -9,7 +9,8 @@ ast::DeclarationNode::DeclarationNode(
 )
 :   _type(type),
     _identifier(std::move(identifier)),
-    _expression(std::move(expression))
+    _expression(std::move(expression)),
+    _slot(0)
 {}
 
 void ast::DeclarationNode::accept(ast::IVisitor &v)
@@ -38,5 +39,20 @@ ast::DeclarationNode::ptr ast::DeclarationNode::create(
     const ast::ExpressionNode::ptr &expression
 )
 {
-    return std::make_shared<ast::DeclarationNode>(type, identifier, expression);
+    return Arena::make<ast::DeclarationNode>(type, identifier, expression);
+}
+
+void ast::DeclarationNode::setSlot(std::size_t slot) noexcept
+{
+    this->_slot = slot;
+}
+
+std::size_t ast::DeclarationNode::getSlot() const noexcept
+{
+    return this->_slot;
+}
+
+void ast::DeclarationNode::setExpression(ast::ExpressionNode::ptr expression) noexcept
+{
+    this->_expression = std::move(expression);
 }
@@ -4,3 +4,13 @@
 //{
 //    visitor.visit(*this);
 //}
+
+void ast::ExpressionNode::setType(std::optional<Token::Type> type) noexcept
+{
+    this->_type = type;
+}
+
+std::optional<Token::Type> ast::ExpressionNode::getType() const noexcept
+{
+    return this->_type;
+}
@@ -18,5 +18,10 @@ const ast::ExpressionNode::ptr &ast::ExpressionStatementNode::getExpression() co
 
 ast::ExpressionStatementNode::ptr ast::ExpressionStatementNode::create(const ast::ExpressionNode::ptr &expression)
 {
-    return std::make_shared<ExpressionStatementNode>(expression);
+    return Arena::make<ExpressionStatementNode>(expression);
+}
+
+void ast::ExpressionStatementNode::setExpression(ast::ExpressionNode::ptr expression) noexcept
+{
+    this->_expression = std::move(expression);
 }
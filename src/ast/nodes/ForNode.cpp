@@ -8,7 +8,7 @@ ast::ForNode::ptr ast::ForNode::create(
     const ast::StepStatementNode::ptr &stepStmt,
     const ast::StatementNode::ptr &statement
 ) {
-    return std::make_shared<ForNode>(expression, initStmt, stepStmt, statement);
+    return Arena::make<ForNode>(expression, initStmt, stepStmt, statement);
 }
 
 ast::ForNode::ForNode(
@@ -20,7 +20,8 @@ ast::ForNode::ForNode(
 :   _expr(std::move(expression)),
     _init(initStmt ? std::move(initStmt) : nullptr),
     _step(stepStmt ? std::move(stepStmt) : nullptr),
-    _stmt(statement ? std::move(statement) : nullptr)
+    _stmt(statement ? std::move(statement) : nullptr),
+    _layout()
 {}
 
 void ast::ForNode::accept(ast::IVisitor &visitor)
@@ -47,3 +48,23 @@ const ast::InitStatementNode::ptr &ast::ForNode::getInitStatement() const
 {
     return this->_init;
 }
+
+void ast::ForNode::setLayout(runtime::Layout layout) noexcept
+{
+    this->_layout = std::move(layout);
+}
+
+const runtime::Layout &ast::ForNode::getLayout() const noexcept
+{
+    return this->_layout;
+}
+
+void ast::ForNode::setExpression(ast::ExpressionNode::ptr expression) noexcept
+{
+    this->_expr = std::move(expression);
+}
+
+void ast::ForNode::setStatement(ast::StatementNode::ptr statement) noexcept
+{
+    this->_stmt = std::move(statement);
+}
@@ -9,7 +9,7 @@ ast::FunctionNode::ptr ast::FunctionNode::create(
     const ast::BlockNode::ptr &block
 )
 {
-    return std::make_shared<FunctionNode>(identifier, params, returnType, block);
+    return Arena::make<FunctionNode>(identifier, params, returnType, block);
 }
 
 ast::FunctionNode::FunctionNode(
@@ -20,7 +20,11 @@ ast::FunctionNode::FunctionNode(
 ):  _identifier(std::move(identifier)),
     _params(params),
     _returnType(returnType),
-    _block(std::move(block))
+    _block(std::move(block)),
+    _slot(0),
+    _frame(),
+    _locals(),
+    _returnChecked(false)
 {
 }
 
@@ -48,3 +52,43 @@ Token::Type ast::FunctionNode::getReturnType() const
 {
     return this->_returnType;
 }
+
+void ast::FunctionNode::setSlot(std::size_t slot) noexcept
+{
+    this->_slot = slot;
+}
+
+std::size_t ast::FunctionNode::getSlot() const noexcept
+{
+    return this->_slot;
+}
+
+void ast::FunctionNode::setFrame(runtime::Layout frame) noexcept
+{
+    this->_frame = std::move(frame);
+}
+
+const runtime::Layout &ast::FunctionNode::getFrame() const noexcept
+{
+    return this->_frame;
+}
+
+void ast::FunctionNode::setLocals(std::vector<std::size_t> locals) noexcept
+{
+    this->_locals = std::move(locals);
+}
+
+const std::vector<std::size_t> &ast::FunctionNode::getLocals() const noexcept
+{
+    return this->_locals;
+}
+
+void ast::FunctionNode::setReturnChecked(bool checked) noexcept
+{
+    this->_returnChecked = checked;
+}
+
+bool ast::FunctionNode::isReturnChecked() const noexcept
+{
+    return this->_returnChecked;
+}
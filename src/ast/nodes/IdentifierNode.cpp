@@ -1,12 +1,15 @@
 #include "IdentifierNode.hpp"
+#include "Object.hpp"
 
 ast::IdentifierNode::ptr ast::IdentifierNode::create(const std::string &identifier)
 {
-    return std::make_shared<IdentifierNode>(identifier);
+    return Arena::make<IdentifierNode>(identifier);
 }
 
 ast::IdentifierNode::IdentifierNode(std::string identifier)
-:   _identifier(std::move(identifier))
+:   _identifier(std::move(identifier)),
+    _address(),
+    _function(nullptr)
 {
 }
 
@@ -15,7 +18,32 @@ void ast::IdentifierNode::accept(ast::IVisitor &visitor)
     visitor.visit(*this);
 }
 
+runtime::Object ast::IdentifierNode::evaluate(ast::IExpressionVisitor &visitor)
+{
+    return visitor.evaluate(*this);
+}
+
 const std::string &ast::IdentifierNode::getIdentifier() const noexcept
 {
     return this->_identifier;
 }
+
+void ast::IdentifierNode::setAddress(const runtime::Address &address) noexcept
+{
+    this->_address = address;
+}
+
+const runtime::Address &ast::IdentifierNode::getAddress() const noexcept
+{
+    return this->_address;
+}
+
+void ast::IdentifierNode::setFunction(const ast::FunctionNode *function) noexcept
+{
+    this->_function = function;
+}
+
+const ast::FunctionNode *ast::IdentifierNode::getFunction() const noexcept
+{
+    return this->_function;
+}
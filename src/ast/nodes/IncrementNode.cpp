@@ -7,7 +7,8 @@ ast::IncrementNode::IncrementNode(
     Token::Type op
 )
     :   _identifier(std::move(identifier)),
-        _op(op)
+        _op(op),
+        _specialization(Specialization::UNSPECIALIZED)
 {
     if (op != Token::INCR && op != Token::DECR)
         throw InternalError("IncrementNode ctor : expecting -- or ++");
@@ -27,10 +28,40 @@ ast::IncrementNode::ptr ast::IncrementNode::create(
     const std::string &identifier,
     Token::Type op
 ) {
-    return std::make_shared<IncrementNode>(identifier, op);
+    return Arena::make<IncrementNode>(identifier, op);
 }
 
 Token::Type ast::IncrementNode::getOperator() const
 {
     return this->_op;
 }
+
+void ast::IncrementNode::setAddress(const runtime::Address &address) noexcept
+{
+    this->_address = address;
+}
+
+const runtime::Address &ast::IncrementNode::getAddress() const noexcept
+{
+    return this->_address;
+}
+
+void ast::IncrementNode::setTargetType(std::optional<Token::Type> type) noexcept
+{
+    this->_targetType = type;
+}
+
+std::optional<Token::Type> ast::IncrementNode::getTargetType() const noexcept
+{
+    return this->_targetType;
+}
+
+void ast::IncrementNode::specialize(ast::Specialization specialization) noexcept
+{
+    this->_specialization = specialization;
+}
+
+ast::Specialization ast::IncrementNode::getSpecialization() const noexcept
+{
+    return this->_specialization;
+}
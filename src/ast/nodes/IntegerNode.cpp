@@ -1,8 +1,10 @@
 #include "IntegerNode.hpp"
+#include "Object.hpp"
 
 ast::IntegerNode::IntegerNode(Token::Integer value)
 :   _value(value)
 {
+    this->setType(Token::INT_TYPE);
 }
 
 void ast::IntegerNode::accept(ast::IVisitor &visitor)
@@ -10,6 +12,11 @@ void ast::IntegerNode::accept(ast::IVisitor &visitor)
     visitor.visit(*this);
 }
 
+runtime::Object ast::IntegerNode::evaluate(ast::IExpressionVisitor &visitor)
+{
+    return visitor.evaluate(*this);
+}
+
 Token::Integer ast::IntegerNode::getValue() const
 {
     return this->_value;
@@ -17,5 +24,5 @@ Token::Integer ast::IntegerNode::getValue() const
 
 ast::IntegerNode::ptr ast::IntegerNode::create(Token::Integer value)
 {
-    return std::make_shared<ast::IntegerNode>(value);
+    return Arena::make<ast::IntegerNode>(value);
 }
@@ -1,6 +1,7 @@
 #include <utility>
 
 #include "LogicalNode.hpp"
+#include "Object.hpp"
 
 const std::initializer_list<Token::Type> logicalOperators{
     Token::AND, Token::OR,
@@ -11,7 +12,7 @@ ast::LogicalNode::ptr ast::LogicalNode::create(
     const ast::ExpressionNode::ptr &left,
     const ast::ExpressionNode::ptr &right
 ) {
-    return std::make_shared<ast::LogicalNode>(oprt, left, right);
+    return Arena::make<ast::LogicalNode>(oprt, left, right);
 }
 
 ast::LogicalNode::LogicalNode(
@@ -32,6 +33,11 @@ void ast::LogicalNode::accept(ast::IVisitor &visitor)
     visitor.visit(*this);
 }
 
+runtime::Object ast::LogicalNode::evaluate(ast::IExpressionVisitor &visitor)
+{
+    return visitor.evaluate(*this);
+}
+
 Token::Type ast::LogicalNode::getOperator() const
 {
     return this->_operator;
@@ -46,3 +52,13 @@ const ast::ExpressionNode::ptr &ast::LogicalNode::getRightChild() const
 {
     return this->_rightChild;
 }
+
+void ast::LogicalNode::setLeftChild(ast::ExpressionNode::ptr child) noexcept
+{
+    this->_leftChild = std::move(child);
+}
+
+void ast::LogicalNode::setRightChild(ast::ExpressionNode::ptr child) noexcept
+{
+    this->_rightChild = std::move(child);
+}
@@ -2,7 +2,7 @@
 
 ast::PrintNode::ptr ast::PrintNode::create(const ast::ExpressionNode::ptr &expr)
 {
-    return std::make_shared<PrintNode>(expr);
+    return Arena::make<PrintNode>(expr);
 }
 
 ast::PrintNode::PrintNode(ast::ExpressionNode::ptr expr)
@@ -19,3 +19,8 @@ const ast::ExpressionNode::ptr &ast::PrintNode::getExpression() const
 {
     return this->_expression;
 }
+
+void ast::PrintNode::setExpression(ast::ExpressionNode::ptr expression) noexcept
+{
+    this->_expression = std::move(expression);
+}
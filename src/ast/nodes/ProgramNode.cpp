@@ -1,7 +1,9 @@
 #include "ProgramNode.hpp"
 
-ast::ProgramNode::ProgramNode(const std::list<StatementNode::ptr> &statements)
-:   _statements(statements)
+#include <utility>
+
+ast::ProgramNode::ProgramNode(std::vector<StatementNode::ptr> statements)
+:   _statements(std::move(statements))
 {
 }
 
@@ -10,12 +12,17 @@ void ast::ProgramNode::accept(ast::IVisitor &visitor)
     visitor.visit(*this);
 }
 
-const std::list<ast::StatementNode::ptr> &ast::ProgramNode::getStatements() const
+const std::vector<ast::StatementNode::ptr> &ast::ProgramNode::getStatements() const
 {
     return this->_statements;
 }
 
-ast::ProgramNode::ptr ast::ProgramNode::create(const std::list<StatementNode::ptr> &statements)
+ast::ProgramNode::ptr ast::ProgramNode::create(std::vector<StatementNode::ptr> statements)
+{
+    return Arena::make<ProgramNode>(std::move(statements));
+}
+
+void ast::ProgramNode::setStatements(std::vector<ast::StatementNode::ptr> statements) noexcept
 {
-    return std::make_shared<ProgramNode>(statements);
+    this->_statements = std::move(statements);
 }
@@ -4,7 +4,7 @@
 
 ast::ReturnNode::ptr ast::ReturnNode::create(const ast::ExpressionNode::ptr &expr)
 {
-    return std::make_shared<ReturnNode>(expr);
+    return Arena::make<ReturnNode>(expr);
 }
 
 ast::ReturnNode::ReturnNode(ast::ExpressionNode::ptr expr)
@@ -21,3 +21,8 @@ const ast::ExpressionNode::ptr &ast::ReturnNode::getExpression() const
 {
     return this->_expr;
 }
+
+void ast::ReturnNode::setExpression(ast::ExpressionNode::ptr expression) noexcept
+{
+    this->_expr = std::move(expression);
+}
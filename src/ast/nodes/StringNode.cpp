@@ -1,12 +1,15 @@
 #include "StringNode.hpp"
+#include "Object.hpp"
 
 ast::StringNode::StringNode(Token::String s)
 :   _s(std::move(s))
-{}
+{
+    this->setType(Token::STR_TYPE);
+}
 
 ast::StringNode::ptr ast::StringNode::create(const Token::String &s)
 {
-    return std::make_shared<ast::StringNode>(s);
+    return Arena::make<ast::StringNode>(s);
 }
 
 void ast::StringNode::accept(ast::IVisitor &visitor)
@@ -14,6 +17,11 @@ void ast::StringNode::accept(ast::IVisitor &visitor)
     visitor.visit(*this);
 }
 
+runtime::Object ast::StringNode::evaluate(ast::IExpressionVisitor &visitor)
+{
+    return visitor.evaluate(*this);
+}
+
 const Token::String &ast::StringNode::getValue() const
 {
     return this->_s;
@@ -1,4 +1,5 @@
 #include "UnaryNode.hpp"
+#include "Object.hpp"
 
 #include <utility>
 
@@ -8,7 +9,7 @@ const std::initializer_list<Token::Type> unaryOperators{
 
 ast::UnaryNode::ptr ast::UnaryNode::create(Token::Type oprt, const ast::ExpressionNode::ptr &child)
 {
-    return std::make_shared<UnaryNode>(oprt, child);
+    return Arena::make<UnaryNode>(oprt, child);
 }
 
 ast::UnaryNode::UnaryNode(Token::Type oprt, ast::ExpressionNode::ptr child)
@@ -23,6 +24,11 @@ void ast::UnaryNode::accept(ast::IVisitor &visitor)
     visitor.visit(*this);
 }
 
+runtime::Object ast::UnaryNode::evaluate(ast::IExpressionVisitor &visitor)
+{
+    return visitor.evaluate(*this);
+}
+
 Token::Type ast::UnaryNode::getOperator() const
 {
     return this->_operator;
@@ -32,3 +38,8 @@ const ast::ExpressionNode::ptr &ast::UnaryNode::getChild() const
 {
     return this->_child;
 }
+
+void ast::UnaryNode::setChild(ast::ExpressionNode::ptr child) noexcept
+{
+    this->_child = std::move(child);
+}
@@ -6,7 +6,7 @@ ast::WhileNode::ptr ast::WhileNode::create(
     const ast::ExpressionNode::ptr &expression,
     const ast::StatementNode::ptr &statement
 ) {
-    return std::make_shared<WhileNode>(expression, statement);
+    return Arena::make<WhileNode>(expression, statement);
 }
 
 ast::WhileNode::WhileNode(ast::ExpressionNode::ptr expression, ast::StatementNode::ptr statement)
@@ -28,3 +28,13 @@ const ast::StatementNode::ptr &ast::WhileNode::getStatement() const
 {
     return this->_stmt;
 }
+
+void ast::WhileNode::setExpression(ast::ExpressionNode::ptr expression) noexcept
+{
+    this->_expr = std::move(expression);
+}
+
+void ast::WhileNode::setStatement(ast::StatementNode::ptr statement) noexcept
+{
+    this->_stmt = std::move(statement);
+}
@@ -0,0 +1,392 @@
+#include <utility>
+
+#include "CompileVisitor.hpp"
+#include "Function.hpp"
+
+ast::CompileVisitor::CompileVisitor()
+:   _chunk(),
+    _loops(),
+    _scopeDepth(0),
+    _inFunction(false)
+{}
+
+vm::Chunk &ast::CompileVisitor::getChunk() noexcept
+{
+    return this->_chunk;
+}
+
+void ast::CompileVisitor::visit(ast::IntegerNode &node)
+{
+    this->_chunk.emit(vm::Chunk::INTEGER, static_cast<uint32_t>(node.getValue()));
+}
+
+void ast::CompileVisitor::visit(ast::StringNode &node)
+{
+    this->_chunk.emit(vm::Chunk::CONSTANT, this->_chunk.addConstant(node.getValue()));
+}
+
+void ast::CompileVisitor::visit(ast::BinaryNode &node)
+{
+    const auto &left = node.getLeftChild();
+    const auto &right = node.getRightChild();
+    auto kind = left->getType() == Token::INT_TYPE && right->getType() == Token::INT_TYPE
+        ? vm::Chunk::OPERANDS_INTEGER
+        : vm::Chunk::OPERANDS_ANY;
+
+    this->compile(left);
+    this->compile(right);
+
+    switch (node.getOperator()) {
+        case Token::MOD:            this->_chunk.emit(vm::Chunk::MOD, 0, kind); break;
+        case Token::DIV:            this->_chunk.emit(vm::Chunk::DIV, 0, kind); break;
+        case Token::MULT:           this->_chunk.emit(vm::Chunk::MULT, 0, kind); break;
+        case Token::PLUS:           this->_chunk.emit(vm::Chunk::ADD, 0, kind); break;
+        case Token::MINUS:          this->_chunk.emit(vm::Chunk::SUB, 0, kind); break;
+        case Token::EQUAL:          this->_chunk.emit(vm::Chunk::EQUAL, 0, kind); break;
+        case Token::NOT_EQUAL:      this->_chunk.emit(vm::Chunk::NOT_EQUAL, 0, kind); break;
+        case Token::GT:             this->_chunk.emit(vm::Chunk::GT, 0, kind); break;
+        case Token::GTE:            this->_chunk.emit(vm::Chunk::GTE, 0, kind); break;
+        case Token::LT:             this->_chunk.emit(vm::Chunk::LT, 0, kind); break;
+        case Token::LTE:            this->_chunk.emit(vm::Chunk::LTE, 0, kind); break;
+        case Token::BITWISE_OR:     this->_chunk.emit(vm::Chunk::BITWISE_OR, 0, kind); break;
+        case Token::BITWISE_XOR:    this->_chunk.emit(vm::Chunk::BITWISE_XOR, 0, kind); break;
+        case Token::BITWISE_AND:    this->_chunk.emit(vm::Chunk::BITWISE_AND, 0, kind); break;
+        case Token::BITWISE_LSHIFT: this->_chunk.emit(vm::Chunk::BITWISE_LSHIFT, 0, kind); break;
+        case Token::BITWISE_RSHIFT: this->_chunk.emit(vm::Chunk::BITWISE_RSHIFT, 0, kind); break;
+
+        default:
+            throw InternalError("CompileVisitor: unknown operator");
+    }
+}
+
+void ast::CompileVisitor::visit(ast::UnaryNode &node)
+{
+    auto kind = node.getChild()->getType() == Token::INT_TYPE
+        ? vm::Chunk::OPERANDS_INTEGER
+        : vm::Chunk::OPERANDS_ANY;
+
+    this->compile(node.getChild());
+
+    switch (node.getOperator()) {
+        case Token::PLUS:           this->_chunk.emit(vm::Chunk::POSITIVE, 0, kind); break;
+        case Token::MINUS:          this->_chunk.emit(vm::Chunk::NEGATIVE, 0, kind); break;
+        case Token::NOT:            this->_chunk.emit(vm::Chunk::NOT, 0, kind); break;
+        case Token::BITWISE_NOT:    this->_chunk.emit(vm::Chunk::BITWISE_NOT, 0, kind); break;
+
+        default:
+            throw InternalError("CompileVisitor: unknown operator");
+    }
+}
+
+void ast::CompileVisitor::visit(ast::LogicalNode &node)
+{
+    this->compile(node.getLeftChild());
+
+    std::size_t shortCircuit;
+
+    switch (node.getOperator()) {
+        case Token::AND:    shortCircuit = this->emitJump(vm::Chunk::AND); break;
+        case Token::OR:     shortCircuit = this->emitJump(vm::Chunk::OR); break;
+
+        default:
+            throw InternalError("CompileVisitor: operator is not logical");
+    }
+
+    this->compile(node.getRightChild());
+    this->_chunk.emit(vm::Chunk::BOOL);
+
+    this->patchJump(shortCircuit);
+}
+
+void ast::CompileVisitor::visit(ast::IdentifierNode &node)
+{
+    this->_chunk.emit(vm::Chunk::LOAD, this->_chunk.addVariable(node.getIdentifier(), node.getAddress()));
+}
+
+void ast::CompileVisitor::visit(ast::ExpressionStatementNode &node)
+{
+    this->compile(node.getExpression());
+    this->_chunk.emit(vm::Chunk::POP);
+}
+
+void ast::CompileVisitor::visit(ast::DeclarationNode &node)
+{
+    const auto &expression = node.getExpression();
+    auto variable = this->_chunk.addVariable(node.getIdentifier(), runtime::Address{.depth = 0, .slot = node.getSlot()});
+
+    if (!expression) {
+        this->_chunk.emit(vm::Chunk::DECLARE, variable, node.getType());
+        return;
+    }
+
+    this->compile(expression);
+    this->_chunk.emit(vm::Chunk::DECLARE_ASSIGN, variable, node.getType());
+}
+
+void ast::CompileVisitor::visit(ast::AssignmentNode &node)
+{
+    this->compile(node.getExpression());
+    this->_chunk.emit(
+        vm::Chunk::ASSIGN,
+        this->_chunk.addVariable(node.getIdentifier(), node.getAddress()),
+        node.getOperator()
+    );
+}
+
+void ast::CompileVisitor::visit(ast::PrintNode &node)
+{
+    const auto &expr = node.getExpression();
+
+    if (expr)
+        this->compile(expr);
+
+    this->_chunk.emit(vm::Chunk::PRINT, 0, expr != nullptr);
+}
+
+void ast::CompileVisitor::visit(ast::BlockNode &node)
+{
+    if (!node.isScoped()) {
+        for (const auto &stmt: node.getStatements())
+            this->compile(stmt);
+
+        return;
+    }
+
+    this->_chunk.emit(vm::Chunk::ENTER_SCOPE, this->_chunk.addLayout(node.getLayout()));
+    this->_scopeDepth++;
+
+    for (const auto &stmt: node.getStatements())
+        this->compile(stmt);
+
+    this->_scopeDepth--;
+    this->_chunk.emit(vm::Chunk::EXIT_SCOPE, 1);
+}
+
+void ast::CompileVisitor::visit(ast::WhileNode &node)
+{
+    auto start = this->_chunk.size();
+
+    this->compile(node.getExpression());
+    auto exit = this->emitJump(vm::Chunk::JUMP_IF_FALSE);
+
+    Loop loop{.scopeDepth = this->_scopeDepth, .breakJumps = {}, .continueJumps = {}};
+    this->compileLoopBody(node.getStatement(), loop);
+
+    this->patchJumps(loop.continueJumps, start);
+    this->_chunk.emit(vm::Chunk::JUMP, start);
+
+    this->patchJump(exit);
+    this->patchJumps(loop.breakJumps, this->_chunk.size());
+}
+
+void ast::CompileVisitor::visit(ast::ConditionNode &node)
+{
+    const auto &elseBranch = node.getElseBranch();
+
+    this->compile(node.getExpression());
+    auto elseJump = this->emitJump(vm::Chunk::JUMP_IF_FALSE);
+
+    this->compile(node.getIfBranch());
+
+    if (!elseBranch) {
+        this->patchJump(elseJump);
+        return;
+    }
+
+    auto endJump = this->emitJump(vm::Chunk::JUMP);
+
+    this->patchJump(elseJump);
+    this->compile(elseBranch);
+    this->patchJump(endJump);
+}
+
+void ast::CompileVisitor::visit(ast::ForNode &node)
+{
+    const auto &init = node.getInitStatement();
+    const auto &step = node.getStepStatement();
+
+    if (init) {
+        this->_chunk.emit(vm::Chunk::ENTER_SCOPE, this->_chunk.addLayout(node.getLayout()));
+        this->_scopeDepth++;
+        this->compile(init);
+    }
+
+    auto start = this->_chunk.size();
+
+    this->compile(node.getExpression());
+    auto exit = this->emitJump(vm::Chunk::JUMP_IF_FALSE);
+
+    Loop loop{.scopeDepth = this->_scopeDepth, .breakJumps = {}, .continueJumps = {}};
+    this->compileLoopBody(node.getStatement(), loop);
+
+    this->patchJumps(loop.continueJumps, this->_chunk.size());
+
+    if (step)
+        this->compile(step);
+
+    this->_chunk.emit(vm::Chunk::JUMP, start);
+
+    this->patchJump(exit);
+    this->patchJumps(loop.breakJumps, this->_chunk.size());
+
+    if (init) {
+        this->_scopeDepth--;
+        this->_chunk.emit(vm::Chunk::EXIT_SCOPE, 1);
+    }
+}
+
+void ast::CompileVisitor::visit(ast::IncrementNode &node)
+{
+    this->_chunk.emit(
+        vm::Chunk::INCREMENT,
+        this->_chunk.addVariable(node.getIdentifier(), node.getAddress()),
+        node.getOperator()
+    );
+}
+
+void ast::CompileVisitor::visit(ast::FunctionNode &node)
+{
+    // Functions are compiled into their own chunk, loops and scopes of the enclosing code are not visible from it.
+    auto enclosingChunk = std::move(this->_chunk);
+    auto enclosingLoops = std::move(this->_loops);
+    auto enclosingScopeDepth = this->_scopeDepth;
+    auto enclosingInFunction = this->_inFunction;
+
+    this->_chunk = vm::Chunk();
+    this->_loops.clear();
+    this->_scopeDepth = 0;
+    this->_inFunction = true;
+
+    this->compile(node.getBlock());
+    this->_chunk.emit(vm::Chunk::RETURN, 0, vm::Chunk::RETURN_IMPLICIT);
+
+    auto function = vm::Function::create(node, std::move(this->_chunk));
+
+    this->_chunk = std::move(enclosingChunk);
+    this->_loops = std::move(enclosingLoops);
+    this->_scopeDepth = enclosingScopeDepth;
+    this->_inFunction = enclosingInFunction;
+
+    this->_chunk.emit(vm::Chunk::FUNCTION, this->_chunk.addFunction(function));
+}
+
+void ast::CompileVisitor::visit(ast::CallNode &node)
+{
+    const auto &params = node.getParams();
+
+    this->compile(node.getCallee());
+
+    for (const auto &param: params)
+        this->compile(param);
+
+    // A tail call which is not made in place is followed by the return of its value
+    this->_chunk.emit(
+        node.isTailCall() ? vm::Chunk::TAIL_CALL : vm::Chunk::CALL,
+        params.size(),
+        node.isChecked() ? vm::Chunk::CALL_UNCHECKED : vm::Chunk::CALL_CHECKED
+    );
+}
+
+void ast::CompileVisitor::visit(ast::ReturnNode &node)
+{
+    const auto &expr = node.getExpression();
+
+    if (expr)
+        this->compile(expr);
+
+    if (!this->_inFunction) {
+        this->_chunk.emit(vm::Chunk::INVALID_JUMP, 0, vm::Chunk::JUMP_RETURN);
+        return;
+    }
+
+    this->_chunk.emit(vm::Chunk::RETURN, 0, expr ? vm::Chunk::RETURN_VALUE : vm::Chunk::RETURN_NOTHING);
+}
+
+void ast::CompileVisitor::visit(ast::BreakNode &_)
+{
+    (void)_;
+
+    if (this->_loops.empty()) {
+        this->_chunk.emit(vm::Chunk::INVALID_JUMP, 0, vm::Chunk::JUMP_BREAK);
+        return;
+    }
+
+    auto &loop = this->_loops.back();
+
+    this->emitExitScopes(loop.scopeDepth);
+    loop.breakJumps.push_back(this->emitJump(vm::Chunk::JUMP));
+}
+
+void ast::CompileVisitor::visit(ast::ContinueNode &_)
+{
+    (void)_;
+
+    if (this->_loops.empty()) {
+        this->_chunk.emit(vm::Chunk::INVALID_JUMP, 0, vm::Chunk::JUMP_CONTINUE);
+        return;
+    }
+
+    auto &loop = this->_loops.back();
+
+    this->emitExitScopes(loop.scopeDepth);
+    loop.continueJumps.push_back(this->emitJump(vm::Chunk::JUMP));
+}
+
+void ast::CompileVisitor::visit(ast::ProgramNode &node)
+{
+    for (const auto &stmt : node.getStatements())
+        this->compile(stmt);
+
+    this->_chunk.emit(vm::Chunk::RETURN, 0, vm::Chunk::RETURN_IMPLICIT);
+}
+
+void ast::CompileVisitor::compile(const ast::ExpressionNode::ptr &expr)
+{
+    if (!expr)
+        throw InternalError("CompileVisitor: expr is null");
+
+    expr->accept(*this);
+}
+
+void ast::CompileVisitor::compile(const ast::StatementNode::ptr &stmt)
+{
+    if (!stmt)
+        throw InternalError("CompileVisitor: stmt is null");
+
+    stmt->accept(*this);
+}
+
+std::size_t ast::CompileVisitor::emitJump(vm::Chunk::OpCode opcode)
+{
+    // Target is patched once known
+    return this->_chunk.emit(opcode);
+}
+
+void ast::CompileVisitor::patchJump(std::size_t jump)
+{
+    this->_chunk.patch(jump, this->_chunk.size());
+}
+
+void ast::CompileVisitor::patchJumps(const std::vector<std::size_t> &jumps, std::size_t target)
+{
+    for (auto jump: jumps)
+        this->_chunk.patch(jump, target);
+}
+
+void ast::CompileVisitor::emitExitScopes(std::size_t scopeDepth)
+{
+    if (this->_scopeDepth > scopeDepth)
+        this->_chunk.emit(vm::Chunk::EXIT_SCOPE, this->_scopeDepth - scopeDepth);
+}
+
+void ast::CompileVisitor::compileLoopBody(const ast::StatementNode::ptr &stmt, ast::CompileVisitor::Loop &loop)
+{
+    if (!stmt)
+        return;
+
+    this->_loops.push_back(std::move(loop));
+    this->compile(stmt);
+
+    loop = std::move(this->_loops.back());
+    this->_loops.pop_back();
+}
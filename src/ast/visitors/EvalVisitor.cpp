@@ -1,132 +1,228 @@
-#include <unordered_map>
+#include <algorithm>
+#include <string>
+#include <utility>
 
 #include "EvalVisitor.hpp"
 #include "Return.hpp"
 #include "Break.hpp"
 #include "Continue.hpp"
-
-#define OPERATOR_FUNCTION(type, op) {type, [](const auto &l, const auto &r){return l op r;}}
-
-using OperatorFunction = std::function<
-    runtime::Object(const runtime::Object &left, const runtime::Object &right)
->;
-
-static const std::unordered_map<Token::Type, OperatorFunction> operatorFunctionsMap{
-    OPERATOR_FUNCTION(Token::MOD, %),
-    OPERATOR_FUNCTION(Token::DIV, /),
-    OPERATOR_FUNCTION(Token::MULT, *),
-    OPERATOR_FUNCTION(Token::PLUS, +),
-    OPERATOR_FUNCTION(Token::MINUS, -),
-    OPERATOR_FUNCTION(Token::EQUAL, ==),
-    OPERATOR_FUNCTION(Token::NOT_EQUAL, !=),
-    OPERATOR_FUNCTION(Token::GT, >),
-    OPERATOR_FUNCTION(Token::GTE, >=),
-    OPERATOR_FUNCTION(Token::LT, <),
-    OPERATOR_FUNCTION(Token::LTE, <=),
-    OPERATOR_FUNCTION(Token::BITWISE_OR, |),
-    OPERATOR_FUNCTION(Token::BITWISE_XOR, ^),
-    OPERATOR_FUNCTION(Token::BITWISE_AND, &),
-    OPERATOR_FUNCTION(Token::BITWISE_LSHIFT, <<),
-    OPERATOR_FUNCTION(Token::BITWISE_RSHIFT, >>)
-};
+#include "NativeStack.hpp"
 
 void ast::EvalVisitor::visit(ast::IntegerNode &node)
 {
-    this->_expressionResult = node.getValue();
+    (void)this->evaluate(node);
 }
 
 void ast::EvalVisitor::visit(ast::StringNode &node)
 {
-    this->_expressionResult = node.getValue();
+    (void)this->evaluate(node);
 }
 
 void ast::EvalVisitor::visit(ast::BinaryNode &node)
 {
-    const runtime::Object left = this->evaluate(node.getLeftChild());
-    const runtime::Object &right = this->evaluate(node.getRightChild());
+    (void)this->evaluate(node);
+}
 
-    const auto &operatorFunc = operatorFunctionsMap.find(node.getOperator());
+void ast::EvalVisitor::visit(ast::UnaryNode &node)
+{
+    (void)this->evaluate(node);
+}
 
-    if (operatorFunc == operatorFunctionsMap.end())
-        throw InternalError("EvalVisitor: unknown operator");
+void ast::EvalVisitor::visit(ast::LogicalNode &node)
+{
+    (void)this->evaluate(node);
+}
 
-    this->_expressionResult = operatorFunc->second(left, right);
+void ast::EvalVisitor::visit(ast::IdentifierNode &node)
+{
+    (void)this->evaluate(node);
 }
 
-void ast::EvalVisitor::visit(ast::UnaryNode &node)
+runtime::Object ast::EvalVisitor::evaluate(ast::IntegerNode &node)
+{
+    return node.getValue();
+}
+
+runtime::Object ast::EvalVisitor::evaluate(ast::StringNode &node)
+{
+    return node.getValue();
+}
+
+runtime::Object ast::EvalVisitor::evaluate(ast::BinaryNode &node)
+{
+    const auto &leftChild = node.getLeftChild();
+    const auto &rightChild = node.getRightChild();
+    auto oprt = node.getOperator();
+
+    // Operands checked by TypeVisitor
+    if (leftChild->getType() == Token::INT_TYPE && rightChild->getType() == Token::INT_TYPE) {
+        auto left = this->evaluate(leftChild).getInteger();
+        auto right = this->evaluate(rightChild).getInteger();
+
+        return runtime::Object::apply(oprt, left, right);
+    }
+
+    auto left = this->evaluate(leftChild);
+    auto right = this->evaluate(rightChild);
+
+    switch (node.getSpecialization()) {
+        case Specialization::INTEGER:
+            if (left.getType() == Token::INT_TYPE && right.getType() == Token::INT_TYPE)
+                return runtime::Object::apply(oprt, left.getInteger(), right.getInteger());
+
+            node.specialize(Specialization::GENERIC);
+            break;
+
+        case Specialization::STRING:
+            if (left.getType() == Token::STR_TYPE && right.getType() == Token::STR_TYPE)
+                return left.get<Token::String>() + right.get<Token::String>();
+
+            node.specialize(Specialization::GENERIC);
+            break;
+
+        case Specialization::UNSPECIALIZED:
+            node.specialize(specializationOf(left, right, oprt == Token::PLUS));
+            break;
+
+        case Specialization::GENERIC:
+            break;
+    }
+
+    return left.apply(oprt, right);
+}
+
+runtime::Object ast::EvalVisitor::evaluate(ast::UnaryNode &node)
 {
-    const runtime::Object &obj = this->evaluate(node.getChild());
+    auto obj = this->evaluate(node.getChild());
+
+    if (node.getChild()->getType() == Token::INT_TYPE)
+        return runtime::Object::apply(node.getOperator(), obj.getInteger());
 
     switch (node.getOperator()) {
         case Token::PLUS:
-            this->_expressionResult = +obj;
-            break;
+            return +obj;
 
         case Token::MINUS:
-            this->_expressionResult = -obj;
-            break;
+            return -obj;
 
         case Token::NOT:
-            this->_expressionResult = !obj;
-            break;
+            return !obj;
 
         case Token::BITWISE_NOT:
-            this->_expressionResult = ~obj;
-            break;
+            return ~obj;
 
         default:
             throw InternalError("EvalVisitor: unknown operator");
     }
 }
 
-void ast::EvalVisitor::visit(ast::LogicalNode &node)
+runtime::Object ast::EvalVisitor::evaluate(ast::LogicalNode &node)
 {
-    const runtime::Object &left = this->evaluate(node.getLeftChild());
+    auto left = bool(this->evaluate(node.getLeftChild()));
 
     switch (node.getOperator()) {
         case Token::AND:
-            this->_expressionResult = left && this->evaluate(node.getRightChild());
-            break;
+            return Token::Integer(left && this->evaluate(node.getRightChild()));
 
         case Token::OR:
-            this->_expressionResult = left || this->evaluate(node.getRightChild());
-            break;
+            return Token::Integer(left || this->evaluate(node.getRightChild()));
 
         default:
             throw InternalError("EvalVisitor: operator is not logical");
     }
 }
 
-void ast::EvalVisitor::visit(ast::IdentifierNode &node)
+runtime::Object ast::EvalVisitor::evaluate(ast::IdentifierNode &node)
 {
-    this->_expressionResult = this->_localState->find(node.getIdentifier());
+    return this->_localState->load(node.getAddress(), node.getIdentifier());
 }
 
 Token::Integer ast::EvalVisitor::getResult() const
 {
-    return this->_expressionResult.getInteger();
+    return this->_result.getInteger();
 }
 
 void ast::EvalVisitor::visit(ast::ExpressionStatementNode &node)
 {
-    node.getExpression()->accept(*this);
+    this->_result = this->evaluate(node.getExpression());
 }
 
 void ast::EvalVisitor::visit(ast::DeclarationNode &node)
 {
-    runtime::Object object(node.getType(), node.getIdentifier());
+    runtime::Object object(node.getType());
     const auto &expression = node.getExpression();
 
-    if (expression)
-        object.assign(this->evaluate(expression));
+    if (expression) {
+        this->_result = this->evaluate(expression);
+        object.assign(this->_result);
+    }
 
-    this->_localState->set(node.getIdentifier(), object);
+    this->_localState->set(node.getSlot(), node.getIdentifier(), object);
 }
 
 void ast::EvalVisitor::visit(ast::AssignmentNode &node)
 {
-    auto &object = this->_localState->find(node.getIdentifier());
-    auto value = this->evaluate(node.getExpression());
+    auto &object = this->_localState->find(node.getAddress(), node.getIdentifier());
+    const auto &value = this->_result = this->evaluate(node.getExpression());
+
+    // Types checked by TypeVisitor
+    if (node.getTargetType() && node.getTargetType() == node.getExpression()->getType()) {
+        if (node.getOperator() == Token::ASSIGN)
+            object = value;
+        else if (*node.getTargetType() == Token::INT_TYPE)
+            object = runtime::Object::apply(
+                Token::compoundOperator(node.getOperator()),
+                object.getInteger(),
+                value.getInteger()
+            );
+        else
+            object.assign(object + value);
+
+        return;
+    }
+
+    switch (node.getSpecialization()) {
+        case Specialization::INTEGER:
+            if (object.getType() == Token::INT_TYPE && value.getType() == Token::INT_TYPE) {
+                if (node.getOperator() == Token::ASSIGN)
+                    object = value;
+                else
+                    object = runtime::Object::apply(
+                        Token::compoundOperator(node.getOperator()),
+                        object.getInteger(),
+                        value.getInteger()
+                    );
+
+                return;
+            }
+
+            node.specialize(Specialization::GENERIC);
+            break;
+
+        case Specialization::STRING:
+            if (object.getType() == Token::STR_TYPE && value.getType() == Token::STR_TYPE) {
+                if (node.getOperator() == Token::ASSIGN)
+                    object = value;
+                else
+                    object = object.get<Token::String>() + value.get<Token::String>();
+
+                return;
+            }
+
+            node.specialize(Specialization::GENERIC);
+            break;
+
+        case Specialization::UNSPECIALIZED:
+            node.specialize(specializationOf(
+                object,
+                value,
+                node.getOperator() == Token::ASSIGN || node.getOperator() == Token::PLUS_GN
+            ));
+            break;
+
+        case Specialization::GENERIC:
+            break;
+    }
 
     switch (node.getOperator()) {
         case Token::ASSIGN:         object.assign(value); break;
@@ -144,46 +240,69 @@ void ast::EvalVisitor::visit(ast::AssignmentNode &node)
 void ast::EvalVisitor::visit(ast::PrintNode &node)
 {
     const auto &expr = node.getExpression();
-    std::string output;
 
     if (expr)
-        output = this->evaluate(expr).getValueAsString();
+        this->_output->write(this->evaluate(expr));
 
-    this->_output << output << std::endl;
+    this->_output->endLine();
 }
 
 void ast::EvalVisitor::visit(ast::BlockNode &node)
 {
-    this->_localState = runtime::State::create(this->_localState);
+    if (!node.isScoped()) {
+        this->executeStatements(node.getStatements());
+        return;
+    }
+
+    this->_localState = runtime::State::create(this->_localState, node.getLayout());
 
     try {
-        for (const auto &stmt: node.getStatements()) {
-            stmt->accept(*this);
-        }
-    } catch (const LogicalError &err) {
+        this->executeStatements(node.getStatements());
+    } catch (...) {
         this->_localState = this->_localState->restoreParent();
-        throw err;
+        throw;
     }
 
     this->_localState = this->_localState->restoreParent();
 }
 
-void ast::EvalVisitor::visit(ast::ProgramNode &program)
+void ast::EvalVisitor::executeStatements(const std::vector<StatementNode::ptr> &statements)
 {
-    for (const auto &stmt : program.getStatements())
+    for (const auto &stmt: statements) {
         stmt->accept(*this);
+
+        if (this->_completion != Completion::NORMAL)
+            break;
+    }
+}
+
+void ast::EvalVisitor::visit(ast::ProgramNode &program)
+{
+    try {
+        for (const auto &stmt : program.getStatements()) {
+            stmt->accept(*this);
+
+            if (this->_completion != Completion::NORMAL)
+                this->throwJump();
+        }
+    } catch (...) {
+        // Scopes are not all restored when unwinding, but addresses of the next program are relative to the global state.
+        this->_localState = this->_globalState;
+        this->_completion = Completion::NORMAL;
+        this->_returnedObject.reset();
+        throw;
+    }
 }
 
-const runtime::Object &ast::EvalVisitor::evaluate(const ast::ExpressionNode::ptr &expr)
+runtime::Object ast::EvalVisitor::evaluate(const ast::ExpressionNode::ptr &expr)
 {
     if (!expr)
         throw InternalError("EvalVisitor: expr is null");
 
-    expr->accept(*this);
-
-    return this->_expressionResult;
+    return expr->evaluate(*this);
 }
 
+
 const runtime::State &ast::EvalVisitor::getState() const noexcept
 {
     return *this->_localState;
@@ -191,7 +310,7 @@ const runtime::State &ast::EvalVisitor::getState() const noexcept
 
 const runtime::Object &ast::EvalVisitor::value() const noexcept
 {
-    return this->_expressionResult;
+    return this->_result;
 }
 
 void ast::EvalVisitor::clearState() noexcept
@@ -199,10 +318,26 @@ void ast::EvalVisitor::clearState() noexcept
     this->_localState->clear();
 }
 
-ast::EvalVisitor::EvalVisitor(std::ostream &output)
-: _output(output),
-  _expressionResult(),
-  _localState(runtime::State::create())
+void ast::EvalVisitor::setMaxCallDepth(std::size_t depth) noexcept
+{
+    this->_maxCallDepth = depth;
+}
+
+std::size_t ast::EvalVisitor::getMaxCallDepth() const noexcept
+{
+    return this->_maxCallDepth;
+}
+
+ast::EvalVisitor::EvalVisitor(runtime::Output::ptr output, runtime::State::ptr globalState)
+: _output(std::move(output)),
+  _result(),
+  _completion(Completion::NORMAL),
+  _returnedObject(),
+  _globalState(std::move(globalState)),
+  _localState(this->_globalState),
+  _calls(),
+  _maxCallDepth(DEFAULT_MAX_CALL_DEPTH),
+  _tailCallState()
 {}
 
 void ast::EvalVisitor::visit(ast::WhileNode &node)
@@ -211,12 +346,11 @@ void ast::EvalVisitor::visit(ast::WhileNode &node)
     auto obj = this->evaluate(node.getExpression());
 
     while (obj) {
-        try {
-            if (stmt)
-                stmt->accept(*this);
-        } catch (const runtime::Break &_) {
-            break;
-        } catch (const runtime::Continue &_) {
+        if (stmt) {
+            stmt->accept(*this);
+
+            if (!this->completeLoopIteration())
+                break;
         }
 
         obj = this->evaluate(node.getExpression());
@@ -243,18 +377,16 @@ void ast::EvalVisitor::visit(ast::ForNode &node)
     const auto &step = node.getStepStatement();
 
     if (init) {
-        this->_localState = runtime::State::create(this->_localState);
+        this->_localState = runtime::State::create(this->_localState, node.getLayout());
         init->accept(*this);
     }
 
     while (this->evaluate(expr)) {
+        if (stmt) {
+            stmt->accept(*this);
 
-        try {
-            if (stmt)
-                stmt->accept(*this);
-        } catch (const runtime::Break &_) {
-            break;
-        } catch (const runtime::Continue &_) {
+            if (!this->completeLoopIteration())
+                break;
         }
 
         if (step)
@@ -267,7 +399,32 @@ void ast::EvalVisitor::visit(ast::ForNode &node)
 
 void ast::EvalVisitor::visit(ast::IncrementNode &node)
 {
-    auto &object = this->_localState->find(node.getIdentifier());
+    auto &object = this->_localState->find(node.getAddress(), node.getIdentifier());
+
+    auto step = node.getOperator() == Token::INCR ? 1 : -1;
+
+    if (node.getTargetType() == Token::INT_TYPE) {
+        object = object.getInteger() + step;
+        return;
+    }
+
+    switch (node.getSpecialization()) {
+        case Specialization::INTEGER:
+            if (object.getType() == Token::INT_TYPE) {
+                object = object.getInteger() + step;
+                return;
+            }
+
+            node.specialize(Specialization::GENERIC);
+            break;
+
+        case Specialization::UNSPECIALIZED:
+            node.specialize(object.getType() == Token::INT_TYPE ? Specialization::INTEGER : Specialization::GENERIC);
+            break;
+
+        default:
+            break;
+    }
 
     switch (node.getOperator()) {
         case Token::INCR: object.assign(object + 1); break;
@@ -280,95 +437,271 @@ void ast::EvalVisitor::visit(ast::IncrementNode &node)
 
 void ast::EvalVisitor::visit(ast::FunctionNode &node)
 {
-    runtime::Object object(node);
+    runtime::Object object(node.shared_from_this());
 
-    this->_localState->set(node.getIdentifier(), object);
+    this->_localState->set(node.getSlot(), node.getIdentifier(), object);
 }
 
 void ast::EvalVisitor::visit(ast::CallNode &node)
 {
-    auto &callee = this->evaluate(node.getCallee());
+    (void)this->evaluate(node);
+}
+
+runtime::Object ast::EvalVisitor::evaluate(ast::CallNode &node)
+{
+    const auto callee = this->evaluate(node.getCallee());
 
     if (callee.getType() != Token::FNC_TYPE)
         throw LogicalError("object is not callable");
 
-    auto function = callee.get<FunctionNode>();
+    if (const auto *builtin = callee.getIf<runtime::Builtin>())
+        return this->callBuiltin(node, *builtin);
 
-    auto params = node.getParams();
-    auto namedParams = function.getParams();
-
-    if (params.size() != namedParams.size())
-        throw LogicalError("number of arguments mismatch");
+    const auto &shared = callee.getShared<FunctionNode>();
+    const auto &function = *shared;
 
     // Create a new state for the function.
-    // function's state takes global state as parent state, so declared functions can be called from the current function
-    // but variables of the current state cannot be references from current function.
-    auto state = runtime::State::create(this->_localState);
+    // function's state takes the current state as parent state, so the function sees the variables of its caller.
+    auto state = this->bindArguments(node, shared, this->_localState);
 
-    for (std::size_t i = 0; i < params.size(); i++) {
-        auto evaluatedParam = this->evaluate(params[i]);
-        auto namedParam = namedParams[i];
+    // A limit raised past what the native stack holds is lowered to the depth reached
+    if (this->_calls.size() >= this->_maxCallDepth || runtime::NativeStack::exhausted()) {
+        std::vector<std::string_view> chain;
 
-        if (evaluatedParam.getType() != namedParam.type)
-            throw invalidArgType(namedParam.name, evaluatedParam.getType(), namedParam.type);
+        for (const auto &call : this->_calls)
+            chain.emplace_back(call.function->getIdentifier());
 
-        state->set(namedParam.name, evaluatedParam);
+        chain.emplace_back(function.getIdentifier());
+
+        throw callDepthExceeded(std::min(this->_maxCallDepth, this->_calls.size()), chain);
     }
 
     auto originalState = std::move(this->_localState);
-    this->_localState = state;
-    bool hasReturned = false;
+
+    this->_localState = std::move(state);
+    this->_calls.push_back(Call{&function, &originalState});
 
     try {
         function.getBlock()->accept(*this);
-    } catch (const runtime::Return &ret) {
+
+        // Tail calls run the function again in place, with the state of their arguments
+        while (this->_completion == Completion::TAIL_CALL) {
+            this->_completion = Completion::NORMAL;
+            this->_localState = std::move(this->_tailCallState);
+            function.getBlock()->accept(*this);
+        }
+    } catch (...) {
         this->_localState = std::move(originalState);
-        originalState = nullptr;
+        this->_calls.pop_back();
+        throw;
+    }
+
+    this->_localState = std::move(originalState);
+    this->_calls.pop_back();
 
-        hasReturned = true;
+    switch (this->_completion) {
+        case Completion::NORMAL:
+            if (function.getReturnType() != Token::VOID_TYPE)
+                throw missingReturn(function.getReturnType());
+            break;
 
-        if (ret.hasValue()) {
-            const auto& obj = ret.getObject();
+        case Completion::RETURN:
+            this->_completion = Completion::NORMAL;
 
-            if (obj.getType() != function.getReturnType())
-                throw invalidReturnType(obj.getType(), function.getReturnType());
+            if (this->_returnedObject) {
+                auto result = std::move(*this->_returnedObject);
 
-            this->_expressionResult = obj;
+                this->_returnedObject.reset();
 
-        } else if (function.getReturnType() != Token::VOID_TYPE)
-            throw invalidReturnType(Token::Type::VOID_TYPE, function.getReturnType());
-    } catch (const LogicalError &err) {
-        this->_localState = std::move(originalState);
-        throw err;
+                if (!function.isReturnChecked() && result.getType() != function.getReturnType())
+                    throw invalidReturnType(result.getType(), function.getReturnType());
+
+                return result;
+            }
+
+            if (function.getReturnType() != Token::VOID_TYPE)
+                throw invalidReturnType(Token::Type::VOID_TYPE, function.getReturnType());
+            break;
+
+        // break or continue outside of a loop of the function
+        default:
+            this->throwJump();
     }
 
-    if (!hasReturned && function.getReturnType() != Token::VOID_TYPE)
-        throw missingReturn(function.getReturnType());
+    if (node.isValueUsed())
+        throw noReturnValue(function.getIdentifier());
 
-    if (originalState)
-        this->_localState = std::move(originalState);
+    // Calls to void functions still evaluate to an object, as every expression does
+    return runtime::Object();
 }
 
 void ast::EvalVisitor::visit(ast::ReturnNode &node)
 {
-    std::optional<runtime::Object> returnedObject;
+    auto *call = dynamic_cast<CallNode *>(node.getExpression().get());
+
+    if (call && call->isTailCall() && this->prepareTailCall(*call))
+        return;
 
     if (node.getExpression())
-        returnedObject = this->evaluate(node.getExpression());
+        this->_returnedObject = this->evaluate(node.getExpression());
 
-    throw runtime::Return(returnedObject);
+    // The expression may be a call to a function returning no value
+    if (!node.getExpression() || this->_returnedObject->isNull())
+        this->_returnedObject.reset();
+
+    this->_completion = Completion::RETURN;
 }
 
 void ast::EvalVisitor::visit(ast::BreakNode &_)
 {
     (void)_;
-    throw runtime::Break();
+    this->_completion = Completion::BREAK;
 }
 
 void ast::EvalVisitor::visit(ast::ContinueNode &_)
 {
     (void)_;
-    throw runtime::Continue();
+    this->_completion = Completion::CONTINUE;
+}
+
+runtime::State::ptr ast::EvalVisitor::bindArguments(
+    ast::CallNode &node,
+    const std::shared_ptr<const ast::FunctionNode> &function,
+    const runtime::State::ptr &parent
+)
+{
+    const auto &params = node.getParams();
+    const auto &namedParams = function->getParams();
+
+    if (params.size() != namedParams.size())
+        throw LogicalError("number of arguments mismatch");
+
+    // The arguments of calls to functions unknown to TypeVisitor are matched once per function called from the site
+    if (!node.isChecked() && !node.isCached(*function))
+        node.cache(function, argumentsMatch(params, namedParams));
+
+    auto checked = node.isChecked() || node.isCacheChecked();
+    auto state = runtime::State::create(parent, function->getFrame());
+
+    for (std::size_t i = 0; i < params.size(); i++) {
+        auto evaluatedParam = this->evaluate(params[i]);
+        const auto &namedParam = namedParams[i];
+
+        if (!checked && evaluatedParam.getType() != namedParam.type)
+            throw invalidArgType(namedParam.name, evaluatedParam.getType(), namedParam.type);
+
+        state->set(i, namedParam.name, evaluatedParam);
+    }
+
+    return state;
+}
+
+runtime::Object ast::EvalVisitor::callBuiltin(ast::CallNode &node, const runtime::Builtin &builtin)
+{
+    std::vector<runtime::Object> arguments;
+
+    arguments.reserve(node.getParams().size());
+
+    for (const auto &param : node.getParams())
+        arguments.push_back(this->evaluate(param));
+
+    auto result = builtin.call(arguments);
+
+    if (result.isNull() && node.isValueUsed())
+        throw noReturnValue(builtin.getIdentifier());
+
+    return result;
+}
+
+bool ast::EvalVisitor::argumentsMatch(
+    const std::vector<ExpressionNode::ptr> &params,
+    const std::vector<FunctionNode::Param> &namedParams
+) noexcept
+{
+    for (std::size_t i = 0; i < params.size(); i++) {
+        if (params[i]->getType() != namedParams[i].type)
+            return false;
+    }
+
+    return true;
+}
+
+ast::Specialization ast::EvalVisitor::specializationOf(
+    const runtime::Object &left,
+    const runtime::Object &right,
+    bool concatenates
+) noexcept
+{
+    if (left.getType() != right.getType())
+        return Specialization::GENERIC;
+
+    if (left.getType() == Token::INT_TYPE)
+        return Specialization::INTEGER;
+
+    if (left.getType() == Token::STR_TYPE && concatenates)
+        return Specialization::STRING;
+
+    return Specialization::GENERIC;
+}
+
+bool ast::EvalVisitor::prepareTailCall(ast::CallNode &node)
+{
+    auto callee = this->evaluate(node.getCallee());
+
+    if (this->_calls.empty())
+        return false;
+
+    const auto &call = this->_calls.back();
+
+    // Only calls to the function being executed reuse its frame, others are run as usual.
+    // So do calls replacing variables which a function may look up, as they would no longer see them.
+    if (callee.getIf<FunctionNode>() != call.function || this->_globalState->isLookedUp(call.function->getLocals()))
+        return false;
+
+    // The new frame takes the place of the current one, below the state of the caller
+    this->_tailCallState = this->bindArguments(node, callee.getShared<FunctionNode>(), *call.callerState);
+    this->_completion = Completion::TAIL_CALL;
+
+    return true;
+}
+
+bool ast::EvalVisitor::completeLoopIteration() noexcept
+{
+    switch (this->_completion) {
+        case Completion::NORMAL:
+            return true;
+
+        case Completion::CONTINUE:
+            this->_completion = Completion::NORMAL;
+            return true;
+
+        case Completion::BREAK:
+            this->_completion = Completion::NORMAL;
+            return false;
+
+        // Returns go through loops, up to the call
+        default:
+            return false;
+    }
+}
+
+void ast::EvalVisitor::throwJump()
+{
+    // Only reached when a jump is not handled by any loop or call : it is reported as an error by the Evaluator.
+    auto completion = this->_completion;
+    auto returnedObject = std::move(this->_returnedObject);
+
+    this->_completion = Completion::NORMAL;
+    this->_returnedObject.reset();
+
+    switch (completion) {
+        case Completion::BREAK:     throw runtime::Break();
+        case Completion::CONTINUE:  throw runtime::Continue();
+        case Completion::RETURN:    throw runtime::Return(returnedObject);
+
+        default:
+            throw InternalError("EvalVisitor: no jump to throw");
+    }
 }
 
 LogicalError ast::EvalVisitor::invalidArgType(std::string paramName, Token::Type actualType, Token::Type expectedType) {
@@ -395,3 +728,29 @@ LogicalError ast::EvalVisitor::missingReturn(Token::Type actualType)
         Token::typeToString(actualType)
     ));
 }
+
+LogicalError ast::EvalVisitor::noReturnValue(std::string_view identifier)
+{
+    return LogicalError(fmt::format("{}: function returns no value", identifier));
+}
+
+LogicalError ast::EvalVisitor::callDepthExceeded(std::size_t maxDepth, const std::vector<std::string_view> &chain)
+{
+    // Consecutive calls to the same function, such as recursive ones, are listed once
+    std::string calls;
+
+    for (std::size_t i = 0; i < chain.size();) {
+        auto count = std::size_t(1);
+
+        while (i + count < chain.size() && chain[i + count] == chain[i])
+            count++;
+
+        if (!calls.empty())
+            calls += " -> ";
+
+        calls += count > 1 ? fmt::format("{} (x{})", chain[i], count) : std::string(chain[i]);
+        i += count;
+    }
+
+    return LogicalError(fmt::format("maximum call depth of {} exceeded : {}", maxDepth, calls));
+}
@@ -0,0 +1,331 @@
+#include <utility>
+
+#include "FoldVisitor.hpp"
+
+ast::FoldVisitor::FoldVisitor()
+:   _expression(),
+    _statement(),
+    _replaced(false)
+{}
+
+void ast::FoldVisitor::visit(ast::IntegerNode &_)
+{
+    (void)_;
+}
+
+void ast::FoldVisitor::visit(ast::StringNode &_)
+{
+    (void)_;
+}
+
+void ast::FoldVisitor::visit(ast::BinaryNode &node)
+{
+    auto oprt = node.getOperator();
+
+    node.setLeftChild(this->fold(node.getLeftChild()));
+    node.setRightChild(this->fold(node.getRightChild()));
+
+    const auto &left = node.getLeftChild();
+    const auto &right = node.getRightChild();
+    auto leftValue = valueOf(left);
+    auto rightValue = valueOf(right);
+
+    if (leftValue && rightValue) {
+        // Dividing the smallest integer by -1 overflows, which would abort the interpreter rather than the program
+        auto overflows = (oprt == Token::DIV || oprt == Token::MOD)
+            && rightValue->getType() == Token::INT_TYPE && rightValue->getInteger() == -1;
+
+        if (overflows)
+            return;
+
+        try {
+            this->replace(leftValue->apply(oprt, *rightValue));
+        } catch (const LogicalError &) {}
+
+        return;
+    }
+
+    // The operand is kept, so it is still evaluated. Only integer operands are, as other types don't implement these
+    // operators and must fail.
+    if (rightValue && rightValue->getType() == Token::INT_TYPE && isInteger(left)) {
+        if (isIdentity(oprt, rightValue->getInteger(), true))
+            this->replace(left);
+    } else if (leftValue && leftValue->getType() == Token::INT_TYPE && isInteger(right)) {
+        if (isIdentity(oprt, leftValue->getInteger(), false))
+            this->replace(right);
+    }
+}
+
+void ast::FoldVisitor::visit(ast::UnaryNode &node)
+{
+    node.setChild(this->fold(node.getChild()));
+
+    auto value = valueOf(node.getChild());
+
+    if (!value)
+        return;
+
+    try {
+        this->replace(value->apply(node.getOperator()));
+    } catch (const LogicalError &) {}
+}
+
+void ast::FoldVisitor::visit(ast::LogicalNode &node)
+{
+    node.setLeftChild(this->fold(node.getLeftChild()));
+    node.setRightChild(this->fold(node.getRightChild()));
+
+    auto left = conditionOf(node.getLeftChild());
+
+    if (!left)
+        return;
+
+    // The right operand is short-circuited
+    if (node.getOperator() == Token::AND ? !*left : *left) {
+        this->replace(runtime::Object(Token::Integer(*left)));
+        return;
+    }
+
+    auto right = conditionOf(node.getRightChild());
+
+    if (right)
+        this->replace(runtime::Object(Token::Integer(*right)));
+}
+
+void ast::FoldVisitor::visit(ast::IdentifierNode &_)
+{
+    (void)_;
+}
+
+void ast::FoldVisitor::visit(ast::ExpressionStatementNode &node)
+{
+    node.setExpression(this->fold(node.getExpression()));
+}
+
+void ast::FoldVisitor::visit(ast::DeclarationNode &node)
+{
+    if (node.getExpression())
+        node.setExpression(this->fold(node.getExpression()));
+}
+
+void ast::FoldVisitor::visit(ast::AssignmentNode &node)
+{
+    node.setExpression(this->fold(node.getExpression()));
+}
+
+void ast::FoldVisitor::visit(ast::PrintNode &node)
+{
+    if (node.getExpression())
+        node.setExpression(this->fold(node.getExpression()));
+}
+
+void ast::FoldVisitor::visit(ast::BlockNode &node)
+{
+    node.setStatements(this->fold(node.getStatements()));
+}
+
+void ast::FoldVisitor::visit(ast::WhileNode &node)
+{
+    node.setExpression(this->fold(node.getExpression()));
+
+    if (conditionOf(node.getExpression()) == false) {
+        this->replace(StatementNode::ptr());
+        return;
+    }
+
+    if (node.getStatement())
+        node.setStatement(this->fold(node.getStatement()));
+}
+
+void ast::FoldVisitor::visit(ast::ConditionNode &node)
+{
+    node.setExpression(this->fold(node.getExpression()));
+
+    const auto &elseBranch = node.getElseBranch();
+    auto condition = conditionOf(node.getExpression());
+
+    if (condition) {
+        const auto &branch = *condition ? node.getIfBranch() : elseBranch;
+
+        this->replace(branch ? this->fold(branch) : nullptr);
+        return;
+    }
+
+    node.setIfBranch(this->foldBranch(node.getIfBranch()));
+
+    if (elseBranch)
+        node.setElseBranch(this->fold(elseBranch));
+}
+
+void ast::FoldVisitor::visit(ast::ForNode &node)
+{
+    // Init and step statements are never replaced
+    if (node.getInitStatement())
+        this->fold(node.getInitStatement());
+
+    if (node.getExpression())
+        node.setExpression(this->fold(node.getExpression()));
+
+    if (node.getStepStatement())
+        this->fold(node.getStepStatement());
+
+    if (node.getStatement())
+        node.setStatement(this->fold(node.getStatement()));
+}
+
+void ast::FoldVisitor::visit(ast::IncrementNode &_)
+{
+    (void)_;
+}
+
+void ast::FoldVisitor::visit(ast::FunctionNode &node)
+{
+    node.getBlock()->accept(*this);
+}
+
+void ast::FoldVisitor::visit(ast::CallNode &node)
+{
+    const auto &params = node.getParams();
+
+    for (std::size_t i = 0; i < params.size(); i++)
+        node.setParam(i, this->fold(params[i]));
+}
+
+void ast::FoldVisitor::visit(ast::ReturnNode &node)
+{
+    if (node.getExpression())
+        node.setExpression(this->fold(node.getExpression()));
+}
+
+void ast::FoldVisitor::visit(ast::BreakNode &_)
+{
+    (void)_;
+}
+
+void ast::FoldVisitor::visit(ast::ContinueNode &_)
+{
+    (void)_;
+}
+
+void ast::FoldVisitor::visit(ast::ProgramNode &node)
+{
+    node.setStatements(this->fold(node.getStatements()));
+}
+
+ast::ExpressionNode::ptr ast::FoldVisitor::fold(const ast::ExpressionNode::ptr &expr)
+{
+    if (!expr)
+        throw InternalError("FoldVisitor: expr is null");
+
+    expr->accept(*this);
+
+    auto folded = std::move(this->_expression);
+
+    return folded ? folded : expr;
+}
+
+ast::StatementNode::ptr ast::FoldVisitor::fold(const ast::StatementNode::ptr &stmt)
+{
+    if (!stmt)
+        throw InternalError("FoldVisitor: stmt is null");
+
+    stmt->accept(*this);
+
+    if (!std::exchange(this->_replaced, false))
+        return stmt;
+
+    return std::move(this->_statement);
+}
+
+ast::StatementNode::ptr ast::FoldVisitor::foldBranch(const ast::StatementNode::ptr &stmt)
+{
+    auto folded = this->fold(stmt);
+
+    // A branch is never empty
+    return folded ? folded : BlockNode::create({});
+}
+
+std::vector<ast::StatementNode::ptr> ast::FoldVisitor::fold(const std::vector<StatementNode::ptr> &statements)
+{
+    std::vector<StatementNode::ptr> folded;
+
+    folded.reserve(statements.size());
+
+    for (const auto &stmt : statements) {
+        auto foldedStmt = this->fold(stmt);
+
+        if (foldedStmt)
+            folded.push_back(std::move(foldedStmt));
+    }
+
+    return folded;
+}
+
+void ast::FoldVisitor::replace(const runtime::Object &value)
+{
+    if (value.getType() == Token::INT_TYPE)
+        this->replace(IntegerNode::create(value.getInteger()));
+    else if (value.getType() == Token::STR_TYPE)
+        this->replace(StringNode::create(value.get<Token::String>()));
+}
+
+void ast::FoldVisitor::replace(ast::ExpressionNode::ptr expr)
+{
+    this->_expression = std::move(expr);
+}
+
+void ast::FoldVisitor::replace(ast::StatementNode::ptr stmt)
+{
+    this->_statement = std::move(stmt);
+    this->_replaced = true;
+}
+
+std::optional<runtime::Object> ast::FoldVisitor::valueOf(const ast::ExpressionNode::ptr &expr)
+{
+    if (const auto *integer = dynamic_cast<const IntegerNode *>(expr.get()))
+        return runtime::Object(integer->getValue());
+
+    if (const auto *string = dynamic_cast<const StringNode *>(expr.get()))
+        return runtime::Object(string->getValue());
+
+    return std::nullopt;
+}
+
+std::optional<bool> ast::FoldVisitor::conditionOf(const ast::ExpressionNode::ptr &expr)
+{
+    auto value = valueOf(expr);
+
+    if (!value || value->getType() != Token::INT_TYPE)
+        return std::nullopt;
+
+    return value->getInteger() != 0;
+}
+
+bool ast::FoldVisitor::isInteger(const ast::ExpressionNode::ptr &expr)
+{
+    return expr->getType() == Token::INT_TYPE;
+}
+
+bool ast::FoldVisitor::isIdentity(Token::Type oprt, Token::Integer value, bool right)
+{
+    switch (oprt) {
+        case Token::PLUS:
+        case Token::BITWISE_OR:
+        case Token::BITWISE_XOR:
+            return value == 0;
+
+        case Token::MINUS:
+        case Token::BITWISE_LSHIFT:
+        case Token::BITWISE_RSHIFT:
+            return right && value == 0;
+
+        case Token::MULT:
+            return value == 1;
+
+        case Token::DIV:
+            return right && value == 1;
+
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,413 @@
+#include <algorithm>
+
+#include "ResolveVisitor.hpp"
+
+ast::ResolveVisitor::ResolveVisitor(runtime::State &globalState)
+:   _globalState(globalState),
+    _scopes(),
+    _globalSymbols(),
+    _functions(),
+    _branches(0),
+    _references()
+{}
+
+void ast::ResolveVisitor::visit(ast::IntegerNode &_)
+{
+    (void)_;
+}
+
+void ast::ResolveVisitor::visit(ast::StringNode &_)
+{
+    (void)_;
+}
+
+void ast::ResolveVisitor::visit(ast::BinaryNode &node)
+{
+    this->resolve(node.getLeftChild());
+    this->resolve(node.getRightChild());
+}
+
+void ast::ResolveVisitor::visit(ast::UnaryNode &node)
+{
+    this->resolve(node.getChild());
+}
+
+void ast::ResolveVisitor::visit(ast::LogicalNode &node)
+{
+    this->resolve(node.getLeftChild());
+    this->resolve(node.getRightChild());
+}
+
+void ast::ResolveVisitor::visit(ast::IdentifierNode &node)
+{
+    auto binding = this->lookup(node.getIdentifier());
+
+    node.setAddress(binding.address);
+
+    if (binding.symbol && binding.symbol->function && this->_functions.empty()) {
+        node.setFunction(binding.symbol->function);
+        binding.symbol->references.push_back(&node);
+        this->_references.push_back(&node);
+    }
+
+    node.setType(binding.type);
+}
+
+void ast::ResolveVisitor::visit(ast::ExpressionStatementNode &node)
+{
+    this->resolve(node.getExpression());
+
+    if (auto *call = dynamic_cast<CallNode *>(node.getExpression().get()))
+        call->setValueUsed(false);
+}
+
+void ast::ResolveVisitor::visit(ast::DeclarationNode &node)
+{
+    // The initializer is resolved first, so "int n = n" refers to an outer n.
+    if (node.getExpression())
+        this->resolve(node.getExpression());
+
+    node.setSlot(this->declare(node.getIdentifier(), node.getType()));
+}
+
+void ast::ResolveVisitor::visit(ast::AssignmentNode &node)
+{
+    auto binding = this->lookup(node.getIdentifier());
+
+    node.setAddress(binding.address);
+    node.setTargetType(binding.type);
+
+    if (binding.symbol)
+        forgetFunction(*binding.symbol);
+
+    // The variable assigned may then be that of a caller or of an enclosing scope
+    if (binding.address.dynamic || (binding.symbol && !binding.symbol->definite))
+        this->_globalState.use(this->_globalState.resolve(node.getIdentifier()), runtime::State::ASSIGNED_BY_NAME);
+
+    this->resolve(node.getExpression());
+}
+
+void ast::ResolveVisitor::visit(ast::PrintNode &node)
+{
+    if (node.getExpression())
+        this->resolve(node.getExpression());
+}
+
+void ast::ResolveVisitor::visit(ast::BlockNode &node)
+{
+    const auto &statements = node.getStatements();
+    auto scoped = std::any_of(statements.begin(), statements.end(), [](const auto &stmt) { return declares(*stmt); });
+
+    node.setScoped(scoped);
+
+    if (scoped)
+        this->beginScope();
+
+    for (const auto &stmt: statements)
+        this->resolve(stmt);
+
+    if (scoped)
+        node.setLayout(this->endScope());
+}
+
+void ast::ResolveVisitor::visit(ast::WhileNode &node)
+{
+    this->resolve(node.getExpression());
+
+    if (node.getStatement())
+        this->resolveBranch(node.getStatement(), true);
+}
+
+void ast::ResolveVisitor::visit(ast::ConditionNode &node)
+{
+    this->resolve(node.getExpression());
+    this->resolveBranch(node.getIfBranch());
+
+    if (node.getElseBranch())
+        this->resolveBranch(node.getElseBranch());
+}
+
+void ast::ResolveVisitor::visit(ast::ForNode &node)
+{
+    const auto &init = node.getInitStatement();
+
+    if (init) {
+        this->beginScope();
+        this->resolve(init);
+    }
+
+    this->resolve(node.getExpression());
+
+    if (node.getStatement())
+        this->resolveBranch(node.getStatement(), true);
+
+    if (node.getStepStatement())
+        this->resolveBranch(node.getStepStatement());
+
+    if (init)
+        node.setLayout(this->endScope());
+}
+
+void ast::ResolveVisitor::visit(ast::IncrementNode &node)
+{
+    auto binding = this->lookup(node.getIdentifier());
+
+    node.setAddress(binding.address);
+    node.setTargetType(binding.type);
+}
+
+void ast::ResolveVisitor::visit(ast::FunctionNode &node)
+{
+    node.setSlot(this->declare(node.getIdentifier(), Token::FNC_TYPE, &node));
+
+    // The body only sees the scopes of the function, the others depend on the caller
+    auto enclosing = std::move(this->_scopes);
+
+    this->_scopes.clear();
+    this->_functions.emplace_back();
+    this->beginScope();
+
+    for (const auto &param: node.getParams())
+        this->declare(param.name, param.type);
+
+    this->resolve(node.getBlock());
+    node.setFrame(this->endScope());
+    node.setLocals(std::move(this->_functions.back()));
+
+    this->_scopes = std::move(enclosing);
+    this->_functions.pop_back();
+}
+
+void ast::ResolveVisitor::visit(ast::CallNode &node)
+{
+    this->resolve(node.getCallee());
+
+    for (const auto &param: node.getParams())
+        this->resolve(param);
+}
+
+void ast::ResolveVisitor::visit(ast::ReturnNode &node)
+{
+    if (!node.getExpression())
+        return;
+
+    this->resolve(node.getExpression());
+
+    auto *call = dynamic_cast<CallNode *>(node.getExpression().get());
+
+    if (!call)
+        return;
+
+    // Returning a call to a function which returns no value returns no value either
+    call->setValueUsed(false);
+
+    // Calls by name only, as the callee is evaluated once more when the call is not made in place
+    if (!this->_functions.empty() && dynamic_cast<const IdentifierNode *>(call->getCallee().get()))
+        call->setTailCall(true);
+}
+
+void ast::ResolveVisitor::visit(ast::BreakNode &_)
+{
+    (void)_;
+}
+
+void ast::ResolveVisitor::visit(ast::ContinueNode &_)
+{
+    (void)_;
+}
+
+void ast::ResolveVisitor::visit(ast::ProgramNode &node)
+{
+    for (const auto &stmt : node.getStatements())
+        this->resolve(stmt);
+
+    // The functions the program may call are all resolved, so are the assignments which may replace a function
+    for (auto *reference : this->_references) {
+        const auto usage = this->_globalState.getUsage(this->_globalState.resolve(reference->getIdentifier()));
+
+        if (usage & runtime::State::ASSIGNED_BY_NAME)
+            reference->setFunction(nullptr);
+    }
+
+    this->_globalSymbols.clear();
+    this->_references.clear();
+}
+
+void ast::ResolveVisitor::resolve(const ast::ExpressionNode::ptr &expr)
+{
+    if (!expr)
+        throw InternalError("ResolveVisitor: expr is null");
+
+    expr->accept(*this);
+}
+
+void ast::ResolveVisitor::resolve(const ast::StatementNode::ptr &stmt)
+{
+    if (!stmt)
+        throw InternalError("ResolveVisitor: stmt is null");
+
+    stmt->accept(*this);
+}
+
+void ast::ResolveVisitor::resolveBranch(const ast::StatementNode::ptr &stmt, bool repeated)
+{
+    this->_branches++;
+
+    if (repeated)
+        this->predeclare(*stmt);
+
+    this->resolve(stmt);
+    this->_branches--;
+}
+
+ast::ResolveVisitor::Binding ast::ResolveVisitor::lookup(const std::string &identifier)
+{
+    const auto scopesCount = this->_scopes.size();
+
+    for (std::size_t depth = 0; depth < scopesCount; depth++) {
+        auto &symbols = this->_scopes[scopesCount - depth - 1].symbols;
+        auto found = symbols.find(identifier);
+
+        if (found != symbols.end()) {
+            auto &symbol = found->second;
+
+            // The variable of a caller may be read instead
+            if (!symbol.definite && !this->_functions.empty())
+                this->_globalState.use(this->_globalState.resolve(identifier), runtime::State::LOOKED_UP);
+
+            return Binding{
+                .address = runtime::Address{.depth = depth, .slot = symbol.slot},
+                .type = symbol.type,
+                .symbol = &symbol
+            };
+        }
+    }
+
+    // Undefined identifiers are given a global slot as well, they are reported when executed.
+    Binding binding{
+        .address = runtime::Address{.depth = runtime::Address::GLOBAL, .slot = this->_globalState.resolve(identifier)},
+        .type = std::nullopt,
+        .symbol = nullptr
+    };
+
+    // Functions may be called from any scope, whose variables they see
+    if (!this->_functions.empty()) {
+        binding.address.dynamic = true;
+        this->_globalState.use(binding.address.slot, runtime::State::LOOKED_UP);
+
+        return binding;
+    }
+
+    // Globals defined by previous programs keep their object, a redeclaration fails
+    auto object = this->_globalState.get(identifier);
+    const auto &found = this->_globalSymbols.find(identifier);
+
+    if (object)
+        binding.type = object->getType();
+    else if (found != this->_globalSymbols.end())
+        binding.type = found->second.type;
+
+    return binding;
+}
+
+std::size_t ast::ResolveVisitor::declare(
+    const std::string &identifier,
+    Token::Type type,
+    const FunctionNode *function
+)
+{
+    auto global = this->_globalState.resolve(identifier);
+
+    if (this->_scopes.empty()) {
+        // Declarations of the same identifier which come later fail when executed
+        if (!this->_branches)
+            this->_globalSymbols.insert({identifier, Symbol{global, true, type, nullptr, {}}});
+
+        return global;
+    }
+
+    auto &scope = this->_scopes.back();
+    auto [found, inserted] = scope.symbols.insert({identifier, Symbol{scope.layout.size(), false, {}, nullptr, {}}});
+    auto &symbol = found->second;
+
+    this->_globalState.use(global, runtime::State::DECLARED_LOCALLY);
+
+    if (inserted) {
+        scope.layout.push_back(identifier);
+
+        if (!this->_functions.empty())
+            this->_functions.back().push_back(global);
+    }
+
+    // A redeclaration is given the same slot, it is reported when executed.
+    // So is any declaration following a definite one, whose symbol thus keeps its type and function.
+    if (!symbol.definite && scope.branches == this->_branches) {
+        symbol.definite = true;
+        symbol.type = type;
+        symbol.function = function;
+    }
+
+    return symbol.slot;
+}
+
+void ast::ResolveVisitor::predeclare(const ast::StatementNode &stmt)
+{
+    if (const auto *declaration = dynamic_cast<const DeclarationNode *>(&stmt))
+        this->declare(declaration->getIdentifier(), declaration->getType());
+    else if (const auto *function = dynamic_cast<const FunctionNode *>(&stmt))
+        this->declare(function->getIdentifier(), Token::FNC_TYPE);
+    else if (const auto *condition = dynamic_cast<const ConditionNode *>(&stmt)) {
+        this->predeclare(*condition->getIfBranch());
+
+        if (condition->getElseBranch())
+            this->predeclare(*condition->getElseBranch());
+    } else if (const auto *loop = dynamic_cast<const WhileNode *>(&stmt)) {
+        if (loop->getStatement())
+            this->predeclare(*loop->getStatement());
+    } else if (const auto *loop = dynamic_cast<const ForNode *>(&stmt)) {
+        if (!loop->getInitStatement() && loop->getStatement())
+            this->predeclare(*loop->getStatement());
+    }
+}
+
+void ast::ResolveVisitor::forgetFunction(ast::ResolveVisitor::Symbol &symbol)
+{
+    for (auto *reference : symbol.references)
+        reference->setFunction(nullptr);
+
+    symbol.function = nullptr;
+    symbol.references.clear();
+}
+
+bool ast::ResolveVisitor::declares(const ast::StatementNode &stmt)
+{
+    if (dynamic_cast<const DeclarationNode *>(&stmt) || dynamic_cast<const FunctionNode *>(&stmt))
+        return true;
+
+    // Statements nested without a block of their own declare in the same scope
+    if (const auto *condition = dynamic_cast<const ConditionNode *>(&stmt))
+        return declares(*condition->getIfBranch())
+            || (condition->getElseBranch() && declares(*condition->getElseBranch()));
+
+    if (const auto *loop = dynamic_cast<const WhileNode *>(&stmt))
+        return loop->getStatement() && declares(*loop->getStatement());
+
+    if (const auto *loop = dynamic_cast<const ForNode *>(&stmt))
+        return !loop->getInitStatement() && loop->getStatement() && declares(*loop->getStatement());
+
+    return false;
+}
+
+void ast::ResolveVisitor::beginScope()
+{
+    this->_scopes.push_back(Scope{{}, {}, this->_branches});
+}
+
+runtime::Layout ast::ResolveVisitor::endScope()
+{
+    auto layout = std::move(this->_scopes.back().layout);
+
+    this->_scopes.pop_back();
+
+    return layout;
+}
@@ -0,0 +1,281 @@
+#include "TypeVisitor.hpp"
+#include "EvalVisitor.hpp"
+
+ast::TypeVisitor::TypeVisitor()
+:   _functions()
+{}
+
+void ast::TypeVisitor::visit(ast::IntegerNode &_)
+{
+    (void)_;
+}
+
+void ast::TypeVisitor::visit(ast::StringNode &_)
+{
+    (void)_;
+}
+
+void ast::TypeVisitor::visit(ast::BinaryNode &node)
+{
+    auto oprt = node.getOperator();
+    auto left = this->check(node.getLeftChild());
+    auto right = this->check(node.getRightChild());
+
+    // Raises the error the operation would raise at runtime
+    if (left && right) {
+        node.setType(sample(*left).apply(oprt, sample(*right)).getType());
+        return;
+    }
+
+    if (oprt != Token::PLUS) {
+        node.setType(Token::INT_TYPE);
+        return;
+    }
+
+    // Both operands of an addition are of the same type, or it fails
+    auto known = left ? left : right;
+
+    if (known == Token::INT_TYPE || known == Token::STR_TYPE)
+        node.setType(*known);
+}
+
+void ast::TypeVisitor::visit(ast::UnaryNode &node)
+{
+    auto type = this->check(node.getChild());
+
+    if (type)
+        (void)sample(*type).apply(node.getOperator());
+
+    node.setType(Token::INT_TYPE);
+}
+
+void ast::TypeVisitor::visit(ast::LogicalNode &node)
+{
+    this->checkCondition(node.getLeftChild());
+    this->checkCondition(node.getRightChild());
+
+    node.setType(Token::INT_TYPE);
+}
+
+void ast::TypeVisitor::visit(ast::IdentifierNode &_)
+{
+    // Typed by ResolveVisitor
+    (void)_;
+}
+
+void ast::TypeVisitor::visit(ast::ExpressionStatementNode &node)
+{
+    this->check(node.getExpression());
+}
+
+void ast::TypeVisitor::visit(ast::DeclarationNode &node)
+{
+    if (!node.getExpression())
+        return;
+
+    auto type = this->check(node.getExpression());
+
+    if (type)
+        runtime::Object(node.getType()).assign(sample(*type));
+}
+
+void ast::TypeVisitor::visit(ast::AssignmentNode &node)
+{
+    auto target = node.getTargetType();
+    auto type = this->check(node.getExpression());
+
+    if (!target || !type)
+        return;
+
+    auto object = sample(*target);
+    auto value = sample(*type);
+
+    if (node.getOperator() == Token::ASSIGN)
+        object.assign(value);
+    else
+        object.assign(object.apply(Token::compoundOperator(node.getOperator()), value));
+}
+
+void ast::TypeVisitor::visit(ast::PrintNode &node)
+{
+    if (node.getExpression())
+        this->check(node.getExpression());
+}
+
+void ast::TypeVisitor::visit(ast::BlockNode &node)
+{
+    for (const auto &stmt : node.getStatements())
+        this->check(stmt);
+}
+
+void ast::TypeVisitor::visit(ast::WhileNode &node)
+{
+    this->checkCondition(node.getExpression());
+
+    if (node.getStatement())
+        this->check(node.getStatement());
+}
+
+void ast::TypeVisitor::visit(ast::ConditionNode &node)
+{
+    this->checkCondition(node.getExpression());
+    this->check(node.getIfBranch());
+
+    if (node.getElseBranch())
+        this->check(node.getElseBranch());
+}
+
+void ast::TypeVisitor::visit(ast::ForNode &node)
+{
+    if (node.getInitStatement())
+        this->check(node.getInitStatement());
+
+    this->checkCondition(node.getExpression());
+
+    if (node.getStepStatement())
+        this->check(node.getStepStatement());
+
+    if (node.getStatement())
+        this->check(node.getStatement());
+}
+
+void ast::TypeVisitor::visit(ast::IncrementNode &node)
+{
+    auto target = node.getTargetType();
+
+    if (!target)
+        return;
+
+    auto object = sample(*target);
+
+    object.assign(object.apply(node.getOperator() == Token::INCR ? Token::PLUS : Token::MINUS, Token::Integer(1)));
+}
+
+void ast::TypeVisitor::visit(ast::FunctionNode &node)
+{
+    this->_functions.push_back(Function{.node = &node, .returnChecked = true});
+
+    try {
+        this->check(node.getBlock());
+    } catch (...) {
+        this->_functions.pop_back();
+        throw;
+    }
+
+    node.setReturnChecked(this->_functions.back().returnChecked);
+    this->_functions.pop_back();
+}
+
+void ast::TypeVisitor::visit(ast::CallNode &node)
+{
+    const auto &params = node.getParams();
+    auto callee = this->check(node.getCallee());
+    std::vector<std::optional<Token::Type>> types;
+
+    for (const auto &param : params)
+        types.push_back(this->check(param));
+
+    if (!callee)
+        return;
+
+    if (callee != Token::FNC_TYPE)
+        throw LogicalError("object is not callable");
+
+    const auto *identifier = dynamic_cast<const IdentifierNode *>(node.getCallee().get());
+    const auto *function = identifier ? identifier->getFunction() : nullptr;
+
+    if (!function)
+        return;
+
+    const auto &namedParams = function->getParams();
+    bool checked = true;
+
+    if (params.size() != namedParams.size())
+        throw LogicalError("number of arguments mismatch");
+
+    for (std::size_t i = 0; i < params.size(); i++) {
+        const auto &namedParam = namedParams[i];
+
+        if (!types[i])
+            checked = false;
+        else if (types[i] != namedParam.type)
+            throw EvalVisitor::invalidArgType(namedParam.name, *types[i], namedParam.type);
+    }
+
+    node.setChecked(checked);
+
+    if (function->getReturnType() != Token::VOID_TYPE)
+        node.setType(function->getReturnType());
+}
+
+void ast::TypeVisitor::visit(ast::ReturnNode &node)
+{
+    const auto &expr = node.getExpression();
+    auto type = expr ? this->check(expr) : Token::VOID_TYPE;
+
+    // Returning outside of a function is reported at runtime
+    if (this->_functions.empty())
+        return;
+
+    auto &function = this->_functions.back();
+    auto returnType = function.node->getReturnType();
+
+    if (!type)
+        function.returnChecked = false;
+    else if (type != returnType)
+        throw EvalVisitor::invalidReturnType(*type, returnType);
+}
+
+void ast::TypeVisitor::visit(ast::BreakNode &_)
+{
+    (void)_;
+}
+
+void ast::TypeVisitor::visit(ast::ContinueNode &_)
+{
+    (void)_;
+}
+
+void ast::TypeVisitor::visit(ast::ProgramNode &node)
+{
+    for (const auto &stmt : node.getStatements())
+        this->check(stmt);
+}
+
+std::optional<Token::Type> ast::TypeVisitor::check(const ast::ExpressionNode::ptr &expr)
+{
+    if (!expr)
+        throw InternalError("TypeVisitor: expr is null");
+
+    expr->accept(*this);
+
+    return expr->getType();
+}
+
+void ast::TypeVisitor::check(const ast::StatementNode::ptr &stmt)
+{
+    if (!stmt)
+        throw InternalError("TypeVisitor: stmt is null");
+
+    stmt->accept(*this);
+}
+
+void ast::TypeVisitor::checkCondition(const ast::ExpressionNode::ptr &expr)
+{
+    auto type = this->check(expr);
+
+    if (type)
+        (void)static_cast<bool>(sample(*type));
+}
+
+runtime::Object ast::TypeVisitor::sample(Token::Type type)
+{
+    switch (type) {
+        // Not zero, so that divisions succeed
+        case Token::INT_TYPE:   return Token::Integer(1);
+        case Token::STR_TYPE:   return runtime::Object(Token::STR_TYPE);
+
+        // Operations on functions fail before reading their value
+        default:                return runtime::Object(std::shared_ptr<const vm::Function>());
+    }
+}
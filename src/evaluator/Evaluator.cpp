@@ -1,39 +1,229 @@
+#include <algorithm>
+
 #include "Evaluator.hpp"
+#include "CompileVisitor.hpp"
+#include "ResolveVisitor.hpp"
+#include "TypeVisitor.hpp"
+#include "FoldVisitor.hpp"
 #include "Break.hpp"
 #include "Continue.hpp"
+#include "NativeStack.hpp"
+
+#define STREAM_READ_SIZE (64 * 1024)
+
+void Evaluator::feed(std::string_view expression)
+{
+    try {
+        runtime::NativeStack::run([&]() { this->interpret(expression); });
+    } catch (...) {
+        this->_output->flush();
+        throw;
+    }
+
+    this->_output->flush();
+}
+
+void Evaluator::stream(std::istream &input)
+{
+    try {
+        runtime::NativeStack::run([&]() { this->streamStatements(input); });
+    } catch (...) {
+        this->_parser.clear();
+        this->_output->flush();
+        throw;
+    }
+}
+
+void Evaluator::interpret(std::string_view expression)
+{
+    // Nothing of a program is kept for the next one, even when it fails
+    try {
+        this->_parser.feed(expression);
+
+        auto root = this->_parser.getAstRoot();
+
+        if (root)
+            this->execute(*root);
+    } catch (const runtime::Jump &jump) {
+        this->_parser.clear();
+        throw LogicalError(jump.what());
+    } catch (...) {
+        this->_parser.clear();
+        throw;
+    }
 
-void Evaluator::feed(const std::string &expression)
+    this->_parser.clear();
+}
+
+void Evaluator::streamStatements(std::istream &input)
 {
-    this->_parser.feed(expression);
+    // Input read but not parsed yet, starting at the given position
+    std::string pending;
+    std::size_t line = 0;
+    std::size_t column = 0;
+    bool complete = false;
+
+    while (!complete) {
+        // Reads at least as much as is pending, so a long statement is only lexed a logarithmic number of times.
+        // Reading stops early when no more input is available yet, so statements run as soon as they are read.
+        auto size = pending.size() + std::max<std::size_t>(STREAM_READ_SIZE, pending.size());
+        std::string text;
 
-    auto root = this->_parser.getAstRoot();
+        while (pending.size() < size && std::getline(input, text)) {
+            pending += text;
 
-    if (root) {
+            if (!input.eof())
+                pending += '\n';
 
-        try {
-            root->accept(this->_evalVisitor);
-        } catch (const runtime::Jump &jump) {
-            throw LogicalError(jump.what());
+            if (input.rdbuf()->in_avail() <= 0)
+                break;
         }
+
+        complete = !input;
+
+        // Tokens never span a line break, except string literals which are left pending until they are read entirely
+        auto end = complete ? pending.size() : pending.rfind('\n') + 1;
+        std::string_view source(pending.data(), end);
+
+        this->_parser.open(source, line, column, complete);
+
+        for (auto stmt = this->_parser.parseNext(complete); stmt; stmt = this->_parser.parseNext(complete)) {
+            // Like a whole program, parsing stops at the first token which doesn't start a statement
+            if (!*stmt) {
+                complete = true;
+                break;
+            }
+
+            auto root = ast::ProgramNode::create({*stmt});
+
+            try {
+                this->execute(*root);
+            } catch (const runtime::Jump &jump) {
+                throw LogicalError(jump.what());
+            }
+        }
+
+        const auto *token = this->_parser.getPendingToken();
+        auto parsed = this->_parser.getParsedSize();
+
+        if (token) {
+            line = token->getLine();
+            column = token->getColumn();
+        } else {
+            std::string_view done(pending.data(), parsed);
+            auto lineBreak = done.rfind('\n');
+
+            line += std::count(done.begin(), done.end(), '\n');
+            column = lineBreak == std::string_view::npos ? column + parsed : parsed - lineBreak - 1;
+        }
+
+        this->_parser.clear();
+        pending.erase(0, parsed);
+
+        // Output of the statements run so far is visible before waiting for more input
+        this->_output->flush();
+    }
+}
+
+void Evaluator::feed(std::string_view expression, const vm::Cache &cache)
+{
+    if (this->_mode != Mode::BYTECODE)
+        return this->feed(expression);
+
+    auto chunk = cache.load(expression, *this->_globalState);
+
+    if (!chunk) {
+        runtime::NativeStack::run([&]() { chunk = this->compile(expression); });
+        cache.store(expression, *chunk, *this->_globalState);
+    }
+
+    try {
+        runtime::NativeStack::run([&]() { this->run(*chunk); });
+    } catch (...) {
+        this->_output->flush();
+        throw;
+    }
+
+    this->_output->flush();
+}
+
+void Evaluator::execute(ast::INode &root)
+{
+    ast::ResolveVisitor resolver(*this->_globalState);
+    ast::TypeVisitor checker;
+    ast::FoldVisitor folder;
+
+    root.accept(resolver);
+    root.accept(checker);
+    root.accept(folder);
+
+    if (this->_mode == Mode::TREE_WALKING) {
+        root.accept(this->_evalVisitor);
+        return;
+    }
+
+    ast::CompileVisitor compiler;
+
+    root.accept(compiler);
+    this->_vm.run(compiler.getChunk());
+}
+
+vm::Chunk Evaluator::compile(std::string_view expression)
+{
+    ast::ResolveVisitor resolver(*this->_globalState);
+    ast::TypeVisitor checker;
+    ast::FoldVisitor folder;
+    ast::CompileVisitor compiler;
+
+    try {
+        this->_parser.feed(expression);
+
+        auto root = this->_parser.getAstRoot();
+
+        // Like interpret, nothing runs without a program, but the chunk must still return
+        if (!root)
+            root = ast::ProgramNode::create({});
+
+        root->accept(resolver);
+        root->accept(checker);
+        root->accept(folder);
+        root->accept(compiler);
+    } catch (...) {
+        this->_parser.clear();
+        throw;
     }
 
     this->_parser.clear();
+
+    return std::move(compiler.getChunk());
+}
+
+void Evaluator::run(const vm::Chunk &chunk)
+{
+    try {
+        this->_vm.run(chunk);
+    } catch (const runtime::Jump &jump) {
+        throw LogicalError(jump.what());
+    }
 }
 
 Token::Integer Evaluator::getResult() const noexcept
 {
+    if (this->_mode == Mode::BYTECODE)
+        return this->_vm.getResult();
+
     return this->_evalVisitor.getResult();
 }
 
 void Evaluator::clear() noexcept
 {
     this->_parser.clear();
-    this->_evalVisitor.clearState();
+    this->_globalState->clear();
 }
 
 const runtime::State &Evaluator::getState() const noexcept
 {
-    return this->_evalVisitor.getState();
+    return *this->_globalState;
 }
 
 const ast::EvalVisitor &Evaluator::getVisitor() const noexcept
@@ -41,7 +231,34 @@ const ast::EvalVisitor &Evaluator::getVisitor() const noexcept
     return this->_evalVisitor;
 }
 
-Evaluator::Evaluator(std::ostream &output)
-:   _parser(),
-    _evalVisitor(output)
-{}
+Evaluator::Mode Evaluator::getMode() const noexcept
+{
+    return this->_mode;
+}
+
+void Evaluator::setMaxCallDepth(std::size_t depth) noexcept
+{
+    this->_evalVisitor.setMaxCallDepth(depth);
+    this->_vm.setMaxCallDepth(depth);
+}
+
+std::size_t Evaluator::getMaxCallDepth() const noexcept
+{
+    return this->_evalVisitor.getMaxCallDepth();
+}
+
+void Evaluator::define(const runtime::Builtin::ptr &builtin)
+{
+    runtime::Builtins::bind(*this->_globalState->getParent(), builtin);
+}
+
+Evaluator::Evaluator(std::ostream &output, Evaluator::Mode mode)
+:   _mode(mode),
+    _parser(),
+    _globalState(runtime::State::create(runtime::State::create())),
+    _output(runtime::Output::create(output)),
+    _evalVisitor(this->_output, this->_globalState),
+    _vm(this->_output, this->_globalState)
+{
+    runtime::Builtins::standard().bind(*this->_globalState->getParent());
+}
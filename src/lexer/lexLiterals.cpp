@@ -1,46 +1,45 @@
+#include <memory>
+
 #include "lexer.hpp"
+#include "scan.hpp"
 
-bool Lexer::lexIntegerLiteral(std::string::const_iterator &begin)
+void Lexer::lexIntegerLiteral(std::string_view::const_iterator &begin)
 {
-    if (!std::isdigit(*begin))
-        return false;
-
     auto it = begin;
 
-    for (; std::isdigit(*it); ++it);
+    for (; it != this->_source.end() && classify(*it) == DIGIT; ++it);
 
-    this->pushToken(Token::INTEGER, {begin, it});
+    this->pushToken(Token::INTEGER, std::string_view(begin, it));
 
     begin = it;
-
-    return true;
 }
 
-bool Lexer::lexStringLiteral(std::string::const_iterator &begin)
+bool Lexer::lexStringLiteral(std::string_view::const_iterator &begin, bool complete)
 {
-    if (*begin != '"')
-        return false;
+    const auto *end = std::to_address(this->_source.end());
+    const auto *it = std::to_address(begin) + 1;
 
-    auto it = begin + 1;
+    for (;;) {
+        it = scan::findQuoteOrBackslash(it, end);
 
-    for (; it != this->_expression.end() && *it != '"'; ++it) {
-        auto next = it + 1;
+        if (it == end || *it == '"')
+            break;
 
-        if (
-            next != this->_expression.end() &&
-            *it == '\\' && *next == '"'
-        )
-            ++it;
+        // Skip escaped double quotes
+        it += (it + 1 != end && it[1] == '"') ? 2 : 1;
     }
 
-    if (it == this->_expression.end()) {
-        throw LexicalError("unmatched double quote", {begin, it}, this->_line, this->_column);
-    }
+    const auto size = it - std::to_address(begin);
+
+    if (it == end) {
+        if (!complete)
+            return false;
 
+        throw LexicalError("unmatched double quote", std::string(begin, begin + size), this->_line, this->_column);
+    }
 
-    this->pushToken(Token::STRING, {begin, it + 1});
 
-    begin = it + 1;
+    this->pushToken(Token::STRING, begin, size + 1);
 
     return true;
 }
\ No newline at end of file
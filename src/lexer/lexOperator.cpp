@@ -1,137 +1,72 @@
+#include <array>
+
 #include "lexer.hpp"
-#include "map.hpp"
 
 struct Tok
 {
+    char character;
     Token::Type defaultType;
-    std::unordered_map<char, Token::Type> transformTypes;
-};
 
-static const std::unordered_map<char, Tok> tokenTable{
-    {
-        '%', {Token::MOD, {
-                {'=', Token::MOD_GN}
-            }
-        }
-    },
-    {
-        '/', {Token::DIV, {
-                {'=', Token::DIV_GN}
-            }
-        }
-    },
-    {
-        '*', {
-            Token::MULT, {
-                {'=', Token::MULT_GN}
-            }
-        }
-    },
-    {
-        '+', {
-            Token::PLUS, {
-                {'+', Token::INCR},
-                {'=', Token::PLUS_GN}
-            }
-        }
-    },
-    {
-        '-', {
-            Token::MINUS, {
-                {'-', Token::DECR},
-                {'=', Token::MINUS_GN}
-            }
-        }
-    },
-    {
-        '(', {Token::OPEN_PARENTHESIS, {}}
-    },
-    {
-        ')', {Token::CLOSE_PARENTHESIS, {}}
-    },
-    {
-        '{', {Token::OPEN_BRACKET, {}}
-    },
-    {
-        '}', {Token::CLOSE_BRACKET, {}}
-    },
-    {
-        '[', {Token::OPEN_SQ_BRACKET, {}}
-    },
-    {
-        ']', {Token::CLOSE_SQ_BRACKET, {}}
-    },
-    {
-        '^', {Token::BITWISE_XOR, {}}
-    },
-    {
-        '~', {Token::BITWISE_NOT, {}}
-    },
-    {
-        ';', {Token::SEMICOLON, {}}
-    },
-    {
-        '=', {
-            Token::ASSIGN, {
-                {'=', Token::EQUAL},
-            }
-        }
-    },
-    {
-        '!', {
-            Token::NOT, {
-                {'=', Token::NOT_EQUAL}
-            }
-        }
-    },
-    {
-        '>', {
-            Token::GT, {
-                {'=', Token::GTE},
-                {'>', Token::BITWISE_RSHIFT},
-            }
-        }
-    },
-    {
-        '<', {
-            Token::LT, {
-                {'=', Token::LTE},
-                {'<', Token::BITWISE_LSHIFT}
-            }
-        }
-    },
-    {
-        '&', {
-            Token::BITWISE_AND, {
-                {'&', Token::AND}
-            }
-        }
-    },
-    {
-        '|', {
-            Token::BITWISE_OR, {
-                {'|', Token::OR}
-            }
-        }
-    },
-    {
-        ',', {Token::COMMA, {}}
-    }
+    // Second characters turning the operator into a two characters operator
+    std::array<std::pair<char, Token::Type>, 2> transformTypes;
 };
 
-bool Lexer::lexOperator(std::string::const_iterator &begin)
+static constexpr std::array<Tok, 21> operators{{
+    {'%', Token::MOD, {{{'=', Token::MOD_GN}}}},
+    {'/', Token::DIV, {{{'=', Token::DIV_GN}}}},
+    {'*', Token::MULT, {{{'=', Token::MULT_GN}}}},
+    {'+', Token::PLUS, {{{'+', Token::INCR}, {'=', Token::PLUS_GN}}}},
+    {'-', Token::MINUS, {{{'-', Token::DECR}, {'=', Token::MINUS_GN}}}},
+    {'(', Token::OPEN_PARENTHESIS, {}},
+    {')', Token::CLOSE_PARENTHESIS, {}},
+    {'{', Token::OPEN_BRACKET, {}},
+    {'}', Token::CLOSE_BRACKET, {}},
+    {'[', Token::OPEN_SQ_BRACKET, {}},
+    {']', Token::CLOSE_SQ_BRACKET, {}},
+    {'^', Token::BITWISE_XOR, {}},
+    {'~', Token::BITWISE_NOT, {}},
+    {';', Token::SEMICOLON, {}},
+    {'=', Token::ASSIGN, {{{'=', Token::EQUAL}}}},
+    {'!', Token::NOT, {{{'=', Token::NOT_EQUAL}}}},
+    {'>', Token::GT, {{{'=', Token::GTE}, {'>', Token::BITWISE_RSHIFT}}}},
+    {'<', Token::LT, {{{'=', Token::LTE}, {'<', Token::BITWISE_LSHIFT}}}},
+    {'&', Token::BITWISE_AND, {{{'&', Token::AND}}}},
+    {'|', Token::BITWISE_OR, {{{'|', Token::OR}}}},
+    {',', Token::COMMA, {}}
+}};
+
+// Operator starting with each character, null if none
+static constexpr std::array<const Tok *, 256> createTokenTable()
 {
-    auto match = umap::get(tokenTable, *begin);
+    std::array<const Tok *, 256> table{};
+
+    for (const auto &op: operators)
+        table[static_cast<unsigned char>(op.character)] = &op;
+
+    return table;
+}
+
+static constexpr auto tokenTable = createTokenTable();
+
+bool Lexer::lexOperator(std::string_view::const_iterator &begin)
+{
+    const auto *match = tokenTable[static_cast<unsigned char>(*begin)];
 
     if (!match)
         return false;
 
-    auto transformType = umap::get(match->transformTypes, *(begin + 1));
+    auto next = begin + 1;
+
+    if (next != this->_source.end()) {
+        for (const auto &[character, type]: match->transformTypes) {
+            if (character && character == *next) {
+                this->pushToken(type, begin, 2);
+                return true;
+            }
+        }
+    }
 
-    if (!transformType)
-        this->pushToken(match->defaultType, begin, 1);
-    else
-        this->pushToken(*transformType, begin, 2);
+    this->pushToken(match->defaultType, begin, 1);
 
     return true;
-}
\ No newline at end of file
+}
@@ -1,7 +1,16 @@
+#include <array>
+#include <memory>
+
 #include "lexer.hpp"
-#include "map.hpp"
+#include "scan.hpp"
 
-static const std::unordered_map<std::string, Token::Type> keywordsTable{
+struct Keyword
+{
+    std::string_view word;
+    Token::Type type;
+};
+
+static constexpr std::array<Keyword, 11> keywords{{
     {"int", Token::INT_TYPE},
     {"str", Token::STR_TYPE},
     {"print", Token::PRINT},
@@ -13,32 +22,44 @@ static const std::unordered_map<std::string, Token::Type> keywordsTable{
     {"return", Token::RETURN},
     {"break", Token::BREAK},
     {"continue", Token::CONTINUE}
-};
+}};
 
-bool Lexer::lexProgrammingWord(std::string::const_iterator &begin)
-{
-    if (!isProgrammingWord(*begin))
-        return false;
-
-    auto it = begin;
+#define KEYWORDS_TABLE_SIZE (32)
 
-    for (; isProgrammingWord(*it); ++it);
+// Perfect hash of the keywords : a word can only be the keyword stored at its hash.
+static constexpr std::size_t hashWord(std::string_view word)
+{
+    return (word.size() + std::size_t(word.front()) + std::size_t(word.back())) % KEYWORDS_TABLE_SIZE;
+}
 
-    std::string lexeme(begin, it);
-    Token::Type type = Token::IDENTIFIER;
+static constexpr std::array<Keyword, KEYWORDS_TABLE_SIZE> createKeywordsTable()
+{
+    std::array<Keyword, KEYWORDS_TABLE_SIZE> table{};
 
-    auto keywordType = umap::get(keywordsTable, lexeme);
-    if (keywordType)
-        type = *keywordType;
+    for (const auto &keyword: keywords) {
+        auto &entry = table[hashWord(keyword.word)];
 
-    this->pushToken(type, lexeme);
+        // Not a constant expression, so a collision fails the build
+        if (!entry.word.empty())
+            throw InternalError("keywords hash collision");
 
-    begin = it;
+        entry = keyword;
+    }
 
-    return true;
+    return table;
 }
 
-bool Lexer::isProgrammingWord(char c)
+static constexpr auto keywordsTable = createKeywordsTable();
+
+void Lexer::lexProgrammingWord(std::string_view::const_iterator &begin)
 {
-    return c == '_' || std::isalnum(c);
-}
\ No newline at end of file
+    auto first = std::to_address(begin);
+    auto it = begin + (scan::skipWord(first, std::to_address(this->_source.end())) - first);
+
+    std::string_view lexeme(begin, it);
+    const auto &keyword = keywordsTable[hashWord(lexeme)];
+
+    this->pushToken(keyword.word == lexeme ? keyword.type : Token::IDENTIFIER, lexeme);
+
+    begin = it;
+}
@@ -1,101 +1,147 @@
-#include "lexer.hpp"
+#include <memory>
 
-#define LEXER_FUNCTION(lexerFunc) ([this](std::string::const_iterator &begin) {return this->lexerFunc(begin);})
+#include "lexer.hpp"
+#include "scan.hpp"
 
-Lexer::Lexer()
-:   _lexerFunctions(this->createLexerFunctions()),
-    _queue(),
-    _line(0),
-    _column(0)
+static constexpr std::array<Lexer::CharClass, 256> createCharClasses()
 {
+    std::array<Lexer::CharClass, 256> classes{};
+
+    for (auto c: {' ', '\t', '\r', '\f', '\v'})
+        classes[static_cast<unsigned char>(c)] = Lexer::SPACE;
+
+    for (unsigned char c = '0'; c <= '9'; c++)
+        classes[c] = Lexer::DIGIT;
+
+    for (unsigned char c = 'a'; c <= 'z'; c++)
+        classes[c] = Lexer::WORD;
+
+    for (unsigned char c = 'A'; c <= 'Z'; c++)
+        classes[c] = Lexer::WORD;
+
+    classes['_'] = Lexer::WORD;
+    classes['\n'] = Lexer::NEWLINE;
+    classes['"'] = Lexer::QUOTE;
+
+    return classes;
 }
 
-std::vector<Lexer::LexerFunction> Lexer::createLexerFunctions()
+static constexpr auto charClasses = createCharClasses();
+
+Lexer::Lexer()
+:   _tokens(),
+    _line(0),
+    _column(0),
+    _source(),
+    _lexedSize(0)
 {
-    return std::vector<Lexer::LexerFunction> {
-        LEXER_FUNCTION(lexStringLiteral),
-        LEXER_FUNCTION(lexIntegerLiteral),
-        LEXER_FUNCTION(lexOperator),
-        LEXER_FUNCTION(lexProgrammingWord)
-    };
 }
 
-void Lexer::feed(const std::string &expression)
+void Lexer::feed(std::string_view source, bool complete)
 {
-    this->_expression = expression;
-
-    auto it = this->_expression.cbegin();
-
-    while (it != this->_expression.cend()) {
-        if (*it == '\n') {
-            this->_line++;
-            this->_column = 0;
-            it++;
-            continue;
+    this->_source = source;
+    this->_lexedSize = 0;
+
+    auto it = this->_source.cbegin();
+
+    while (it != this->_source.cend()) {
+        switch (classify(*it)) {
+            case NEWLINE:
+                this->_line++;
+                this->_column = 0;
+                it++;
+                break;
+
+            // Ignore white spaces
+            case SPACE: {
+                auto spaces = scan::skipSpaces(std::to_address(it), std::to_address(this->_source.cend()));
+                auto count = spaces - std::to_address(it);
+
+                this->_column += count;
+                it += count;
+                break;
+            }
+
+            case DIGIT:
+                this->lexIntegerLiteral(it);
+                break;
+
+            case WORD:
+                this->lexProgrammingWord(it);
+                break;
+
+            case QUOTE:
+                if (!this->lexStringLiteral(it, complete)) {
+                    this->_lexedSize = it - this->_source.cbegin();
+                    return;
+                }
+                break;
+
+            default:
+                if (this->lexOperator(it))
+                    break;
+
+                // In case of unknown token, throw
+                throw LexicalError(
+                    "unknown token",
+                    std::string(it, it + 1),
+                    this->_line,
+                    this->_column
+                );
         }
+    }
 
-        // Ignore white spaces
-        if (std::isspace(*it)) {
-            this->_column++;
-            it++;
-            continue;
-        }
+    this->_lexedSize = source.size();
+}
 
-        // Try to lex, continue if lex succeeded
-        if (this->lex(it))
-            continue;
-
-        // In case of unknown token, clear tokens queue and throw
-        throw LexicalError(
-            "unknown token",
-            std::string{it, it + 1},
-            this->_line,
-            this->_column
-        );
-    }
+std::size_t Lexer::getLexedSize() const noexcept
+{
+    return this->_lexedSize;
 }
 
-bool Lexer::lex(std::string::const_iterator &begin)
+void Lexer::setPosition(std::size_t line, std::size_t column) noexcept
 {
-    for (const auto &f : this->_lexerFunctions) {
-        if (f(begin))
-            return true;
-    }
+    this->_line = line;
+    this->_column = column;
+}
 
-    return false;
+Lexer::CharClass Lexer::classify(char c) noexcept
+{
+    return charClasses[static_cast<unsigned char>(c)];
 }
 
 std::size_t Lexer::tokensCount() const noexcept
 {
-    return this->_queue.size();
+    return this->_tokens.size();
 }
 
 void Lexer::clear() noexcept
 {
-    Token::queue cleared;
-    this->_queue.swap(cleared);
+    this->_tokens.clear();
+    this->_source = {};
+    this->_lexedSize = 0;
 
     this->_line = 0;
     this->_column = 0;
 }
 
-void Lexer::pushToken(Token::Type t, const std::string &lexeme)
+void Lexer::pushToken(Token::Type t, std::string_view lexeme)
 {
-    this->_queue.push(Token::create(t, lexeme, this->_line, this->_column));
+    this->_tokens.emplace_back(t, lexeme, this->_line, this->_column);
     this->_column += lexeme.size();
 }
 
 void Lexer::pushToken(
     Token::Type t,
-    std::string::const_iterator &it,
+    std::string_view::const_iterator &it,
     long lexemeSize
 ) {
     const auto begin = it;
     it += lexemeSize;
-    this->pushToken(t, {begin, it});
+    this->pushToken(t, std::string_view(begin, it));
 }
 
-Token::queue &Lexer::getTokens() noexcept
+std::vector<Token> &Lexer::getTokens() noexcept
 {
-    return this->_queue;
+    return this->_tokens;
 }
@@ -0,0 +1,139 @@
+#include <bit>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "scan.hpp"
+
+static bool isSpace(char c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+static bool isWord(char c) noexcept
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+#if defined(__AVX2__)
+
+#define VECTOR_SIZE (32)
+
+using Vector = __m256i;
+
+static Vector load(const char *it) noexcept
+{
+    return _mm256_loadu_si256(reinterpret_cast<const Vector *>(it));
+}
+
+static Vector splat(char c) noexcept { return _mm256_set1_epi8(c); }
+static Vector eq(Vector a, Vector b) noexcept { return _mm256_cmpeq_epi8(a, b); }
+static Vector gt(Vector a, Vector b) noexcept { return _mm256_cmpgt_epi8(a, b); }
+static Vector lt(Vector a, Vector b) noexcept { return _mm256_cmpgt_epi8(b, a); }
+static Vector vor(Vector a, Vector b) noexcept { return _mm256_or_si256(a, b); }
+static Vector vand(Vector a, Vector b) noexcept { return _mm256_and_si256(a, b); }
+static Vector vnot(Vector a) noexcept { return _mm256_xor_si256(a, _mm256_set1_epi8(-1)); }
+static uint32_t mask(Vector v) noexcept { return uint32_t(_mm256_movemask_epi8(v)); }
+
+#elif defined(__SSE2__)
+
+#define VECTOR_SIZE (16)
+
+using Vector = __m128i;
+
+static Vector load(const char *it) noexcept
+{
+    return _mm_loadu_si128(reinterpret_cast<const Vector *>(it));
+}
+
+static Vector splat(char c) noexcept { return _mm_set1_epi8(c); }
+static Vector eq(Vector a, Vector b) noexcept { return _mm_cmpeq_epi8(a, b); }
+static Vector gt(Vector a, Vector b) noexcept { return _mm_cmpgt_epi8(a, b); }
+static Vector lt(Vector a, Vector b) noexcept { return _mm_cmplt_epi8(a, b); }
+static Vector vor(Vector a, Vector b) noexcept { return _mm_or_si128(a, b); }
+static Vector vand(Vector a, Vector b) noexcept { return _mm_and_si128(a, b); }
+static Vector vnot(Vector a) noexcept { return _mm_xor_si128(a, _mm_set1_epi8(-1)); }
+static uint32_t mask(Vector v) noexcept { return uint32_t(_mm_movemask_epi8(v)); }
+
+#endif
+
+#if defined(VECTOR_SIZE)
+
+// Bytes of v within [first, last]. Bytes above 0x7f are negative and never match.
+static Vector inRange(Vector v, char first, char last) noexcept
+{
+    return vand(gt(v, splat(char(first - 1))), lt(v, splat(char(last + 1))));
+}
+
+// Scans [it, end) by blocks while every byte of the block matches, and returns the first mismatching byte,
+// or the beginning of the tail left to the scalar loop.
+template<typename Matcher>
+static const char *skipBlocks(const char *it, const char *end, Matcher matches) noexcept
+{
+    constexpr auto full = uint32_t((uint64_t(1) << VECTOR_SIZE) - 1);
+
+    for (; end - it >= VECTOR_SIZE; it += VECTOR_SIZE) {
+        auto matching = mask(matches(load(it)));
+
+        if (matching != full)
+            return it + std::countr_one(matching);
+    }
+
+    return it;
+}
+
+#endif
+
+const char *scan::skipSpaces(const char *it, const char *end) noexcept
+{
+#if defined(VECTOR_SIZE)
+    it = skipBlocks(it, end, [](Vector v) {
+        // '\t', '\v', '\f' and '\r' surround '\n' which must be kept
+        return vor(
+            eq(v, splat(' ')),
+            vand(inRange(v, '\t', '\r'), vnot(eq(v, splat('\n'))))
+        );
+    });
+
+#endif
+
+    for (; it != end && isSpace(*it); ++it);
+
+    return it;
+}
+
+const char *scan::skipWord(const char *it, const char *end) noexcept
+{
+#if defined(VECTOR_SIZE)
+    it = skipBlocks(it, end, [](Vector v) {
+        // Setting the 0x20 bit maps upper case letters onto lower case ones
+        return vor(
+            vor(inRange(vor(v, splat(0x20)), 'a', 'z'), inRange(v, '0', '9')),
+            eq(v, splat('_'))
+        );
+    });
+
+#endif
+
+    for (; it != end && isWord(*it); ++it);
+
+    return it;
+}
+
+const char *scan::findQuoteOrBackslash(const char *it, const char *end) noexcept
+{
+#if defined(VECTOR_SIZE)
+    it = skipBlocks(it, end, [](Vector v) {
+        return vnot(vor(eq(v, splat('"')), eq(v, splat('\\'))));
+    });
+
+#endif
+
+    for (; it != end && *it != '"' && *it != '\\'; ++it);
+
+    return it;
+}
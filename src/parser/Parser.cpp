@@ -1,15 +1,81 @@
+#include <array>
+
 #include "Parser.hpp"
 
-void Parser::feed(const std::string &expression)
+void Parser::feed(std::string_view expression)
 {
     this->_lexer.feed(expression);
-    this->_tokenItr.reset(this->_lexer.getTokens());
+    this->_tokens.reset(this->_lexer.getTokens());
+
+    // Nodes are allocated in an arena kept alive by the nodes themselves
+    auto arena = ast::Arena::create();
+    ast::Arena::Scope scope(*arena);
+
     this->_astRoot = this->parseProgram();
 }
 
+void Parser::open(std::string_view source, std::size_t line, std::size_t column, bool complete)
+{
+    this->_lexer.clear();
+    this->_lexer.setPosition(line, column);
+    this->_source = source;
+    this->_lexicalError.reset();
+
+    // Tokens lexed before an error are kept, so the statements they form are run before it is thrown
+    try {
+        this->_lexer.feed(source, complete);
+    } catch (const LexicalError &error) {
+        this->_lexicalError = error;
+    }
+
+    this->_tokens.reset(this->_lexer.getTokens());
+}
+
+std::optional<ast::StatementNode::ptr> Parser::parseNext(bool complete)
+{
+    auto position = this->_tokens.mark();
+
+    // Each statement has its own arena, so statements are released independently of each other
+    auto arena = ast::Arena::create();
+    ast::Arena::Scope scope(*arena);
+
+    try {
+        auto stmt = this->parseStatement();
+        auto exhausted = this->_tokens.isExhausted();
+
+        // Tokens stop at a lexical error, so parsing can't go on past them either
+        if (this->_lexicalError ? stmt && !exhausted : complete || !exhausted)
+            return stmt;
+    } catch (const SyntaxError &) {
+        if (!this->_tokens.isExhausted() || (complete && !this->_lexicalError))
+            throw;
+    }
+
+    if (this->_lexicalError)
+        throw *this->_lexicalError;
+
+    this->_tokens.rewind(position);
+
+    return std::nullopt;
+}
+
+const Token *Parser::getPendingToken() const noexcept
+{
+    return this->_tokens.get();
+}
+
+std::size_t Parser::getParsedSize() const noexcept
+{
+    const auto *token = this->getPendingToken();
+
+    return token ? std::size_t(token->getLexeme().data() - this->_source.data()) : this->_lexer.getLexedSize();
+}
+
 void Parser::clear() noexcept
 {
     this->_lexer.clear();
+    this->_source = {};
+    this->_lexicalError.reset();
     this->_astRoot.reset();
 }
 
@@ -20,50 +86,69 @@ const ast::INode::ptr &Parser::getAstRoot() const noexcept
 
 ast::ProgramNode::ptr Parser::parseProgram()
 {
-    std::list<ast::StatementNode::ptr> statements;
+    std::vector<ast::StatementNode::ptr> statements;
 
     for (auto stmt = this->parseStatement(); stmt; stmt = this->parseStatement())
         statements.push_back(stmt);
 
-    return ast::ProgramNode::create(statements);
+    return ast::ProgramNode::create(std::move(statements));
 }
 
 ast::StatementNode::ptr Parser::parseStatement()
 {
-    static const std::vector<ast::StatementNode::ptr(Parser::*)()> statementsParser{
-        &Parser::parseFunction,
-        &Parser::parseAssignmentStatement,
-        &Parser::parseIncrementStatement,
-        &Parser::parseExpressionStatement,
-        &Parser::parseDeclarationStatement,
-        &Parser::parsePrint,
-        &Parser::parseBlockStatement,
-        &Parser::parseWhile,
-        &Parser::parseConditions,
-        &Parser::parseFor,
-        &Parser::parseReturnStatement,
-        &Parser::parseBreakStatement,
-        &Parser::parseContinueStatement
-    };
-
-    for (const auto &parse: statementsParser) {
-        const auto &stmt = (this->*parse)();
-        if (stmt)
-            return stmt;
-    }
+    using StatementParser = ast::StatementNode::ptr (Parser::*)();
+
+    // Parser of the statements starting with each token. Statements starting with any other token can only
+    // be expression statements, which also report misplaced operators.
+    static constexpr auto statementParsers = []() {
+        std::array<StatementParser, Token::IDENTIFIER + 1> parsers{};
+
+        parsers.fill(&Parser::parseExpressionStatement);
+
+        parsers[Token::FNC] = &Parser::parseFunction;
+        parsers[Token::INT_TYPE] = parsers[Token::STR_TYPE] = &Parser::parseDeclarationStatement;
+        parsers[Token::PRINT] = &Parser::parsePrint;
+        parsers[Token::OPEN_BRACKET] = &Parser::parseBlockStatement;
+        parsers[Token::WHILE] = &Parser::parseWhile;
+        parsers[Token::IF] = &Parser::parseConditions;
+        parsers[Token::FOR] = &Parser::parseFor;
+        parsers[Token::RETURN] = &Parser::parseReturnStatement;
+        parsers[Token::BREAK] = &Parser::parseBreakStatement;
+        parsers[Token::CONTINUE] = &Parser::parseContinueStatement;
+        parsers[Token::IDENTIFIER] = &Parser::parseIdentifierStatement;
+
+        return parsers;
+    }();
+
+    auto token = this->_tokens.get();
+    if (!token)
+        return nullptr;
 
-    return nullptr;
+    return (this->*statementParsers[token->getType()])();
+}
+
+ast::StatementNode::ptr Parser::parseIdentifierStatement()
+{
+    auto nextToken = this->_tokens.next();
+
+    if (nextToken && nextToken->isAssignableOperator())
+        return this->parseAssignmentStatement();
+
+    if (nextToken && nextToken->isTypeAnyOf({Token::INCR, Token::DECR}))
+        return this->parseIncrementStatement();
+
+    return this->parseExpressionStatement();
 }
 
 ast::StatementNode::ptr Parser::parseExpressionStatement()
 {
     const auto &expr = this->parseExpression();
-    const auto &token = this->_tokenItr.get();
+    const auto &token = this->_tokens.get();
     if (!expr)
         return nullptr;
 
     if (!token)
-        throw syntaxError("expecting \";\"", *this->_tokenItr.prev());
+        throw syntaxError("expecting \";\"", *this->_tokens.prev());
 
     if (token->isType(Token::CLOSE_PARENTHESIS))
         throw syntaxError("unmatched parenthesis", *token);
@@ -74,7 +159,7 @@ ast::StatementNode::ptr Parser::parseExpressionStatement()
     if (!token->isType(Token::SEMICOLON))
         throw syntaxError("expecting \";\"", *token);
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     return ast::ExpressionStatementNode::create(expr);
 }
@@ -85,12 +170,12 @@ ast::StatementNode::ptr Parser::parseDeclarationStatement()
     if (!decl)
         return nullptr;
 
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
 
     if (!token || !token->isType(Token::SEMICOLON))
-        throw syntaxError("expecting \";\"", *this->_tokenItr.prev());
+        throw syntaxError("expecting \";\"", *this->_tokens.prev());
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     return decl;
 }
@@ -101,11 +186,11 @@ ast::StatementNode::ptr Parser::parseAssignmentStatement()
     if (!assignment)
         return nullptr;
 
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::SEMICOLON))
-        throw syntaxError("expecting \";\"", *this->_tokenItr.prev());
+        throw syntaxError("expecting \";\"", *this->_tokens.prev());
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     return assignment;
 }
@@ -116,11 +201,11 @@ ast::StatementNode::ptr Parser::parseIncrementStatement()
     if (!increment)
         return nullptr;
 
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::SEMICOLON))
-        throw syntaxError("expecting \";\"", *this->_tokenItr.prev());
+        throw syntaxError("expecting \";\"", *this->_tokens.prev());
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     return increment;
 }
@@ -131,66 +216,66 @@ ast::StatementNode::ptr Parser::parseReturnStatement()
     if (!stmt)
         return nullptr;
 
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::SEMICOLON))
-        throw syntaxError("expecting \";\"", *this->_tokenItr.prev());
+        throw syntaxError("expecting \";\"", *this->_tokens.prev());
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     return stmt;
 }
 
 ast::StatementNode::ptr Parser::parseBreakStatement()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::BREAK))
         return nullptr;
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::SEMICOLON))
-        throw syntaxError("expecting \";\"", *this->_tokenItr.prev());
-    this->_tokenItr.advance();
+        throw syntaxError("expecting \";\"", *this->_tokens.prev());
+    this->_tokens.advance();
 
     return ast::BreakNode::create();
 }
 
 ast::StatementNode::ptr Parser::parseContinueStatement()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::CONTINUE))
         return nullptr;
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::SEMICOLON))
-        throw syntaxError("expecting \";\"", *this->_tokenItr.prev());
-    this->_tokenItr.advance();
+        throw syntaxError("expecting \";\"", *this->_tokens.prev());
+    this->_tokens.advance();
 
     return ast::ContinueNode::create();
 }
 
 ast::IncrementNode::ptr Parser::parseIncrement()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::IDENTIFIER))
         return nullptr;
 
-    auto nextToken = this->_tokenItr.next();
+    auto nextToken = this->_tokens.next();
     if (!nextToken || (!nextToken->isType(Token::INCR) && !nextToken->isType(Token::DECR)))
         return nullptr;
 
-    this->_tokenItr.advance().advance();
+    this->_tokens.advance(2);
 
-    return ast::IncrementNode::create(token->getLexeme(), nextToken->getType());
+    return ast::IncrementNode::create(std::string(token->getLexeme()), nextToken->getType());
 }
 
 ast::StatementNode::ptr Parser::parseReturn()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::RETURN))
         return nullptr;
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     auto expr = this->parseExpression();
 
@@ -203,11 +288,11 @@ ast::DeclarationNode::ptr Parser::parseDeclaration()
     if (!typeIdent)
         return nullptr;
 
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     ast::ExpressionNode::ptr expr;
 
     if (token && token->isType(Token::ASSIGN)) {
-        this->_tokenItr.advance();
+        this->_tokens.advance();
 
         expr = this->parseExpression();
         if (!expr)
@@ -219,19 +304,19 @@ ast::DeclarationNode::ptr Parser::parseDeclaration()
 
 ast::AssignmentNode::ptr Parser::parseAssignment()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::IDENTIFIER))
         return nullptr;
 
     std::string identifier(token->getLexeme());
 
-    auto nextToken = this->_tokenItr.next();
+    auto nextToken = this->_tokens.next();
     if (!nextToken || !nextToken->isAssignableOperator())
         return nullptr;
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    token = this->_tokenItr.get();
-    this->_tokenItr.advance();
+    token = this->_tokens.get();
+    this->_tokens.advance();
 
     auto expr = this->parseExpression();
     if (!expr)
@@ -242,21 +327,21 @@ ast::AssignmentNode::ptr Parser::parseAssignment()
 
 ast::StatementNode::ptr Parser::parsePrint()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::PRINT))
         return nullptr;
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::OPEN_PARENTHESIS))
-        throw syntaxError("expecting \"()\"", *this->_tokenItr.prev());
+        throw syntaxError("expecting \"()\"", *this->_tokens.prev());
 
     auto leftParen = *token;
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token)
         throw syntaxError("expecting \"()\"", leftParen);
 
@@ -267,19 +352,19 @@ ast::StatementNode::ptr Parser::parsePrint()
         // Expression is optional in "print" statement, no need to check for nullptr
         expr = this->parseExpression();
 
-        token = this->_tokenItr.get();
+        token = this->_tokens.get();
         if (!token || !token->isType(Token::CLOSE_PARENTHESIS))
             throw syntaxError("unmatched \")\"", leftParen);
 
     }
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::SEMICOLON))
-        throw syntaxError("expecting \";\"", token ? *token : *this->_tokenItr.prev());
+        throw syntaxError("expecting \";\"", token ? *token : *this->_tokens.prev());
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     return ast::PrintNode::create(expr);
 }
@@ -291,14 +376,14 @@ ast::StatementNode::ptr Parser::parseBlockStatement()
 
 ast::BlockNode::ptr Parser::parseBlock()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::OPEN_BRACKET))
         return nullptr;
 
     auto openToken = *token;
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    std::list<ast::StatementNode::ptr> statements;
+    std::vector<ast::StatementNode::ptr> statements;
     auto stmt = this->parseStatement();
 
     while (stmt) {
@@ -306,31 +391,31 @@ ast::BlockNode::ptr Parser::parseBlock()
         stmt = this->parseStatement();
     }
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::CLOSE_BRACKET))
         throw syntaxError("unmatched '{'", openToken);
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    return ast::BlockNode::create(statements);
+    return ast::BlockNode::create(std::move(statements));
 }
 
 ast::StatementNode::ptr Parser::parseWhile()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::WHILE))
         return nullptr;
 
     auto whileToken = *token;
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
     auto expr = this->parseParenthesizedExpression(whileToken);
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token)
         throw syntaxError("expecting statement or \";\"", whileToken);
 
     if (token->isType(Token::SEMICOLON)) {
-        this->_tokenItr.advance();
+        this->_tokens.advance();
         return ast::WhileNode::create(expr);
     }
 
@@ -344,50 +429,50 @@ ast::StatementNode::ptr Parser::parseWhile()
 
 ast::StatementNode::ptr Parser::parseFor()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::FOR))
         return nullptr;
 
     const auto forToken = *token;
 
-    token = this->_tokenItr.advance().get();
+    token = this->_tokens.advance().get();
 
     if (!token || !token->isType(Token::OPEN_PARENTHESIS))
         throw syntaxError("expecting \"(\"", forToken);
 
     const auto parenToken = *token;
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     auto initStmt = this->parseInitStatement();
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::SEMICOLON))
-        throw syntaxError("expecting \";\" after init statement", *this->_tokenItr.prev());
-    this->_tokenItr.advance();
+        throw syntaxError("expecting \";\" after init statement", *this->_tokens.prev());
+    this->_tokens.advance();
 
     auto expr = this->parseExpression();
     if (!expr)
-        throw syntaxError("expecting expression", *this->_tokenItr.prev());
+        throw syntaxError("expecting expression", *this->_tokens.prev());
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::SEMICOLON))
-        throw syntaxError("expecting \";\" after expression", *this->_tokenItr.prev());
-    this->_tokenItr.advance();
+        throw syntaxError("expecting \";\" after expression", *this->_tokens.prev());
+    this->_tokens.advance();
 
     auto stepStatement = this->parseStepStatement();
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::CLOSE_PARENTHESIS))
         throw syntaxError("unmatched \"(\"", parenToken);
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token)
         throw syntaxError("expecting statement or \";\"", forToken);
 
     if (token->isType(Token::SEMICOLON)) {
-        this->_tokenItr.advance();
+        this->_tokens.advance();
         return ast::ForNode::create(expr, initStmt, stepStatement);
     }
 
@@ -401,20 +486,20 @@ ast::StatementNode::ptr Parser::parseFor()
 
 ast::StatementNode::ptr Parser::parseFunction()
 {
-    auto fncToken = this->_tokenItr.get();
+    auto fncToken = this->_tokens.get();
     if (!fncToken || !fncToken->isType(Token::FNC))
         return nullptr;
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    auto identToken = this->_tokenItr.get();
+    auto identToken = this->_tokens.get();
     if (!identToken || !identToken->isType(Token::IDENTIFIER))
         throw syntaxError("expecting identifier", *fncToken);
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    auto open_p = this->_tokenItr.get();
+    auto open_p = this->_tokens.get();
     if (!open_p || !open_p->isType(Token::OPEN_PARENTHESIS))
         throw syntaxError("expecting '('", *identToken);
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     std::map<std::string, bool> paramsMap;
     std::vector<ast::FunctionNode::Param> params;
@@ -423,7 +508,7 @@ ast::StatementNode::ptr Parser::parseFunction()
     while (typeIdent) {
 
         if (paramsMap.find(typeIdent->first) != paramsMap.end())
-            throw syntaxError("parameter name already used", *this->_tokenItr.prev());
+            throw syntaxError("parameter name already used", *this->_tokens.prev());
 
         paramsMap.insert({typeIdent->first, true});
         params.push_back(ast::FunctionNode::Param{
@@ -431,27 +516,27 @@ ast::StatementNode::ptr Parser::parseFunction()
             .type = typeIdent->second
         });
 
-        auto token = this->_tokenItr.get();
+        auto token = this->_tokens.get();
         if (!token || !token->isType(Token::COMMA))
             break;
-        this->_tokenItr.advance();
+        this->_tokens.advance();
 
         typeIdent = this->parseTypeIdent();
     }
 
-    auto close_p = this->_tokenItr.get();
+    auto close_p = this->_tokens.get();
     if (!close_p || !close_p->isType(Token::CLOSE_PARENTHESIS))
         throw syntaxError("unmatched '('", *open_p);
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token)
-        throw syntaxError("expecting return type or block", *this->_tokenItr.prev());
+        throw syntaxError("expecting return type or block", *this->_tokens.prev());
 
     Token::Type returnType = Token::VOID_TYPE;
     if (token->isType(Token::INT_TYPE) || token->isType(Token::STR_TYPE)) {
         returnType = token->getType();
-        this->_tokenItr.advance();
+        this->_tokens.advance();
     }
 
     auto block = this->parseBlock();
@@ -459,7 +544,7 @@ ast::StatementNode::ptr Parser::parseFunction()
         throw syntaxError("expecting function body", *identToken);
 
     return ast::FunctionNode::create(
-        identToken->getLexeme(),
+        std::string(identToken->getLexeme()),
         params,
         returnType,
         block
@@ -488,22 +573,22 @@ ast::StepStatementNode::ptr Parser::parseStepStatement()
 
 ast::StatementNode::ptr Parser::parseConditions()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::IF))
         return nullptr;
 
     auto ifToken = *token;
-    this->_tokenItr.advance();
+    this->_tokens.advance();
     auto ifExpr = this->parseParenthesizedExpression(ifToken);
 
     auto ifStmt = this->parseStatement();
     if (!ifStmt)
         throw syntaxError("expecting statement", ifToken);
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::ELSE))
         return ast::ConditionNode::create(ifExpr, ifStmt);
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     auto elseToken = *token;
 
@@ -514,103 +599,57 @@ ast::StatementNode::ptr Parser::parseConditions()
     return ast::ConditionNode::create(ifExpr, ifStmt, elseStmt);
 }
 
-ast::ExpressionNode::ptr Parser::parseExpression()
+// Binding power of binary operators, from the loosest to the tightest, 0 for other tokens.
+// All binary operators are left associative.
+struct BinaryOperator
 {
-    return this->parseLogicalOr();
-}
+    uint8_t precedence;
+    bool logical;
+};
 
-ast::ExpressionNode::ptr Parser::parseLogicalOr()
+static constexpr std::array<BinaryOperator, Token::IDENTIFIER + 1> createBinaryOperators()
 {
-    return this->parseBinaryExpression(
-        {Token::OR},
-        [this]() { return this->parseLogicalAnd(); },
-        true
-    );
-}
-
-ast::ExpressionNode::ptr Parser::parseLogicalAnd()
-{
-    return this->parseBinaryExpression(
-        {Token::AND},
-        [this]() { return this->parseBitwiseOr(); },
-        true
-    );
-}
-
-ast::ExpressionNode::ptr Parser::parseBitwiseOr()
-{
-    return this->parseBinaryExpression(
-        {Token::BITWISE_OR},
-        [this]() { return this->parseBitwiseXor(); }
-    );
-}
-
-ast::ExpressionNode::ptr Parser::parseBitwiseXor()
-{
-    return this->parseBinaryExpression(
-        {Token::BITWISE_XOR},
-        [this]() { return this->parseBitwiseAnd(); }
-    );
-}
-
-ast::ExpressionNode::ptr Parser::parseBitwiseAnd()
-{
-    return this->parseBinaryExpression(
-        {Token::BITWISE_AND},
-        [this]() { return this->parseEquality(); }
-    );
-}
+    std::array<BinaryOperator, Token::IDENTIFIER + 1> operators{};
 
-ast::ExpressionNode::ptr Parser::parseEquality()
-{
-    return this->parseBinaryExpression(
-        {Token::EQUAL, Token::NOT_EQUAL},
-        [this]() { return this->parseComparison(); }
-    );
-}
-
-ast::ExpressionNode::ptr Parser::parseComparison()
-{
-    return this->parseBinaryExpression(
-        {Token::GT, Token::GTE, Token::LT, Token::LTE},
-        [this]() { return this->parseBitshift(); }
-    );
-}
+    operators[Token::OR] = {1, true};
+    operators[Token::AND] = {2, true};
+    operators[Token::BITWISE_OR] = {3, false};
+    operators[Token::BITWISE_XOR] = {4, false};
+    operators[Token::BITWISE_AND] = {5, false};
+    operators[Token::EQUAL] = operators[Token::NOT_EQUAL] = {6, false};
+    operators[Token::GT] = operators[Token::GTE] = operators[Token::LT] = operators[Token::LTE] = {7, false};
+    operators[Token::BITWISE_LSHIFT] = operators[Token::BITWISE_RSHIFT] = {8, false};
+    operators[Token::PLUS] = operators[Token::MINUS] = {9, false};
+    operators[Token::MULT] = operators[Token::MOD] = operators[Token::DIV] = {10, false};
 
-ast::ExpressionNode::ptr Parser::parseBitshift()
-{
-    return this->parseBinaryExpression(
-        {Token::BITWISE_LSHIFT, Token::BITWISE_RSHIFT},
-        [this]() { return this->parseTerm(); }
-    );
+    return operators;
 }
 
-ast::ExpressionNode::ptr Parser::parseTerm()
-{
-    return this->parseBinaryExpression(
-        {Token::PLUS, Token::MINUS},
-        [this]() { return this->parseFactor(); }
-    );
-}
+static constexpr auto binaryOperators = createBinaryOperators();
 
-ast::ExpressionNode::ptr Parser::parseFactor()
+ast::ExpressionNode::ptr Parser::parseExpression()
 {
-    return this->parseBinaryExpression(
-        {Token::MULT, Token::MOD, Token::DIV},
-        [this]() { return this->parseUnary(); }
-    );
+    return this->parseBinaryExpression(1);
 }
 
 ast::ExpressionNode::ptr Parser::parseUnary()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token)
         return nullptr;
 
-    if (!token->isTypeAnyOf({Token::PLUS, Token::MINUS, Token::NOT, Token::BITWISE_NOT}))
-        return this->parseCall();
+    switch (token->getType()) {
+        case Token::PLUS:
+        case Token::MINUS:
+        case Token::NOT:
+        case Token::BITWISE_NOT:
+            break;
+
+        default:
+            return this->parseCall();
+    }
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     auto expression = this->parseUnary();
     if (!expression)
@@ -624,11 +663,11 @@ ast::ExpressionNode::ptr Parser::parseCall()
     auto expr = this->parsePrimary();
     ast::ExpressionNode::ptr ret;
 
-    auto open_p = this->_tokenItr.get();
+    auto open_p = this->_tokens.get();
     while (open_p && open_p->isType(Token::OPEN_PARENTHESIS)) {
-        this->_tokenItr.advance();
+        this->_tokens.advance();
 
-        auto token = this->_tokenItr.get();
+        auto token = this->_tokens.get();
         if (!token)
             throw syntaxError("expecting argument or \")\"", *open_p);
 
@@ -637,14 +676,14 @@ ast::ExpressionNode::ptr Parser::parseCall()
         // Handle function call without arguments, eg f()
         if (!token->isType(Token::CLOSE_PARENTHESIS)) {
             params = this->parseParams();
-            auto close_p = this->_tokenItr.get();
+            auto close_p = this->_tokens.get();
             if (!close_p || !close_p->isType(Token::CLOSE_PARENTHESIS))
                 throw syntaxError("unmatched parenthesis", *open_p);
         }
 
-        this->_tokenItr.advance();
+        this->_tokens.advance();
         expr = ast::CallNode::create(expr, params);
-        open_p = this->_tokenItr.get();
+        open_p = this->_tokens.get();
     }
 
     return expr;
@@ -658,15 +697,15 @@ std::vector<ast::ExpressionNode::ptr> Parser::parseParams()
 
     std::vector<ast::ExpressionNode::ptr> params = {expr};
 
-    auto comma = this->_tokenItr.get();
+    auto comma = this->_tokens.get();
     while (comma && comma->isType(Token::COMMA)) {
-        this->_tokenItr.advance();
+        this->_tokens.advance();
         expr = this->parseExpression();
         if (!expr)
             throw syntaxError("expecting expression after ','", *comma);
 
         params.push_back(expr);
-        comma = this->_tokenItr.get();
+        comma = this->_tokens.get();
     }
 
     return params;
@@ -674,56 +713,62 @@ std::vector<ast::ExpressionNode::ptr> Parser::parseParams()
 
 ast::ExpressionNode::ptr Parser::parsePrimary()
 {
-    static const std::vector<ast::ExpressionNode::ptr(Parser::*)()> primaryParsers{
-        &Parser::parseInteger,
-        &Parser::parseString,
-        &Parser::parseIdentifier,
-        &Parser::parseGrouping
-    };
+    auto token = this->_tokens.get();
+    if (!token)
+        return nullptr;
 
-    for (const auto &parse: primaryParsers) {
-        const auto &expr = (this->*parse)();
-        if (expr)
-            return expr;
+    switch (token->getType()) {
+        case Token::INTEGER:
+            return this->parseInteger();
 
-    }
+        case Token::STRING:
+            return this->parseString();
+
+        case Token::IDENTIFIER:
+            return this->parseIdentifier();
+
+        case Token::OPEN_PARENTHESIS:
+        case Token::CLOSE_PARENTHESIS:
+            return this->parseGrouping();
 
-    return nullptr;
+        default:
+            return nullptr;
+    }
 }
 
 ast::ExpressionNode::ptr Parser::parseInteger()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::INTEGER))
         return nullptr;
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
     return ast::IntegerNode::create(token->getIntegerLiteral());
 }
 
 ast::ExpressionNode::ptr Parser::parseString()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::STRING))
         return nullptr;
 
-    this->_tokenItr.advance();
-    return ast::StringNode::create(token->getLiteral<Token::String>());
+    this->_tokens.advance();
+    return ast::StringNode::create(token->getStringLiteral());
 }
 
 ast::ExpressionNode::ptr Parser::parseIdentifier()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || !token->isType(Token::IDENTIFIER))
         return nullptr;
 
-    this->_tokenItr.advance();
-    return ast::IdentifierNode::create(token->getLexeme());
+    this->_tokens.advance();
+    return ast::IdentifierNode::create(std::string(token->getLexeme()));
 }
 
 ast::ExpressionNode::ptr Parser::parseGrouping()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token)
         return nullptr;
 
@@ -733,9 +778,9 @@ ast::ExpressionNode::ptr Parser::parseGrouping()
     if (!token->isType(Token::OPEN_PARENTHESIS))
         return nullptr;
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    auto nextToken = this->_tokenItr.get();
+    auto nextToken = this->_tokens.get();
     if (!nextToken || nextToken->isType(Token::CLOSE_PARENTHESIS))
         throw syntaxError("expecting expression", *token);
 
@@ -744,47 +789,50 @@ ast::ExpressionNode::ptr Parser::parseGrouping()
     if (!expression)
         throw syntaxError("expecting expression", *token);
 
-    nextToken = this->_tokenItr.get();
+    nextToken = this->_tokens.get();
 
     if (!nextToken || !nextToken->isType(Token::CLOSE_PARENTHESIS))
         throw syntaxError("expecting \")\"", *token);
 
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     return expression;
 }
 
 SyntaxError Parser::syntaxError(const std::string &errorMessage, const Token &token)
 {
-    return {errorMessage, token.getLexeme(), token.getLine(), token.getColumn()};
+    return {errorMessage, std::string(token.getLexeme()), token.getLine(), token.getColumn()};
 }
 
-ast::ExpressionNode::ptr Parser::parseBinaryExpression(
-    const std::initializer_list<Token::Type> &matchTokens,
-    const Parser::ParseFunction &parseSubExpression,
-    bool logical
-)
+// Parses operands bound by operators at least as tight as minPrecedence.
+// Right operands only take tighter operators, which makes operators left associative.
+ast::ExpressionNode::ptr Parser::parseBinaryExpression(uint8_t minPrecedence)
 {
-    auto expression = parseSubExpression();
+    auto expression = this->parseUnary();
+
+    auto token = this->_tokens.get();
 
-    auto token = this->_tokenItr.get();
+    while (token) {
+        const auto &binaryOperator = binaryOperators[token->getType()];
+
+        if (!binaryOperator.precedence || binaryOperator.precedence < minPrecedence)
+            break;
 
-    while (token && token->isTypeAnyOf(matchTokens)) {
-        this->_tokenItr.advance();
+        this->_tokens.advance();
 
         if (!expression)
             throw syntaxError("expecting expression", *token);
 
-        auto subExpression = parseSubExpression();
+        auto subExpression = this->parseBinaryExpression(binaryOperator.precedence + 1);
         if (!subExpression)
             throw syntaxError("expecting expression", *token);
 
-        if (!logical)
+        if (!binaryOperator.logical)
             expression = ast::BinaryNode::create(token->getType(), expression, subExpression);
         else
             expression = ast::LogicalNode::create(token->getType(), expression, subExpression);
 
-        token = this->_tokenItr.get();
+        token = this->_tokens.get();
     }
 
     return expression;
@@ -792,15 +840,15 @@ ast::ExpressionNode::ptr Parser::parseBinaryExpression(
 
 ast::ExpressionNode::ptr Parser::parseParenthesizedExpression(const Token &prevToken)
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
 
     if (!token || !token->isType(Token::OPEN_PARENTHESIS))
         throw syntaxError("expecting \"(\"", prevToken);
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     auto parenToken = *token;
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token)
         throw syntaxError("expecting expression after \"(\"", prevToken);
     if (token->isType(Token::CLOSE_PARENTHESIS))
@@ -810,27 +858,27 @@ ast::ExpressionNode::ptr Parser::parseParenthesizedExpression(const Token &prevT
     if (!expr)
         throw syntaxError("expecting expression after \"(\"", prevToken);
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::CLOSE_PARENTHESIS))
         throw syntaxError("unmatched \"(\"", parenToken);
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
     return expr;
 }
 
 std::optional<std::pair<std::string, Token::Type>> Parser::parseTypeIdent()
 {
-    auto token = this->_tokenItr.get();
+    auto token = this->_tokens.get();
     if (!token || (!token->isType(Token::INT_TYPE) && !token->isType(Token::STR_TYPE)))
         return {};
 
     Token::Type declarationType = token->getType();
-    this->_tokenItr.advance();
+    this->_tokens.advance();
 
-    token = this->_tokenItr.get();
+    token = this->_tokens.get();
     if (!token || !token->isType(Token::IDENTIFIER))
-        throw syntaxError("expecting identifier", *this->_tokenItr.prev());
-    this->_tokenItr.advance();
+        throw syntaxError("expecting identifier", *this->_tokens.prev());
+    this->_tokens.advance();
 
-    return std::make_pair(token->getLexeme(), declarationType);
+    return std::make_pair(std::string(token->getLexeme()), declarationType);
 }
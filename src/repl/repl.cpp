@@ -63,7 +63,7 @@ void Repl::debug(const std::string &line)
     if (!object)
         this->_error << fmt::format("Error: {} is not defined.", identifier);
     else
-        this->_error << object->string();
+        this->_error << fmt::format("{} = {}", identifier, object->string());
 
     this->_error << std::endl;
 
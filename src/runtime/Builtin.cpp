@@ -0,0 +1,67 @@
+#include <utility>
+
+#include "Builtin.hpp"
+#include "EvalVisitor.hpp"
+
+runtime::Builtin::ptr runtime::Builtin::create(
+    std::string identifier,
+    std::vector<ast::FunctionNode::Param> params,
+    Token::Type returnType,
+    runtime::Builtin::Implementation implementation
+)
+{
+    return std::make_shared<const Builtin>(
+        std::move(identifier),
+        std::move(params),
+        returnType,
+        std::move(implementation)
+    );
+}
+
+runtime::Builtin::Builtin(
+    std::string identifier,
+    std::vector<ast::FunctionNode::Param> params,
+    Token::Type returnType,
+    runtime::Builtin::Implementation implementation
+):  _identifier(std::move(identifier)),
+    _params(std::move(params)),
+    _returnType(returnType),
+    _implementation(std::move(implementation))
+{
+}
+
+const std::string &runtime::Builtin::getIdentifier() const noexcept
+{
+    return this->_identifier;
+}
+
+const std::vector<ast::FunctionNode::Param> &runtime::Builtin::getParams() const noexcept
+{
+    return this->_params;
+}
+
+Token::Type runtime::Builtin::getReturnType() const noexcept
+{
+    return this->_returnType;
+}
+
+runtime::Object runtime::Builtin::call(std::span<const runtime::Object> arguments) const
+{
+    if (arguments.size() != this->_params.size())
+        throw LogicalError("number of arguments mismatch");
+
+    for (std::size_t i = 0; i < arguments.size(); i++) {
+        const auto &param = this->_params[i];
+
+        if (arguments[i].getType() != param.type)
+            throw ast::EvalVisitor::invalidArgType(param.name, arguments[i].getType(), param.type);
+    }
+
+    auto result = this->_implementation(arguments);
+    auto type = result.isNull() ? Token::VOID_TYPE : result.getType();
+
+    if (type != this->_returnType)
+        throw ast::EvalVisitor::invalidReturnType(type, this->_returnType);
+
+    return result;
+}
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <fmt/format.h>
+
+#include "Builtins.hpp"
+
+runtime::Builtins runtime::Builtins::standard()
+{
+    using Arguments = std::span<const Object>;
+    Builtins builtins;
+
+    builtins.add(Builtin::create("len", {{"s", Token::STR_TYPE}}, Token::INT_TYPE, [](Arguments args) {
+        return Object(Token::Integer(args[0].get<Token::String>().size()));
+    }));
+
+    builtins.add(Builtin::create(
+        "substr",
+        {{"s", Token::STR_TYPE}, {"start", Token::INT_TYPE}, {"length", Token::INT_TYPE}},
+        Token::STR_TYPE,
+        [](Arguments args) {
+            const auto &s = args[0].get<Token::String>();
+            auto start = args[1].getInteger();
+            auto length = args[2].getInteger();
+
+            if (start < 0 || std::size_t(start) > s.size())
+                throw LogicalError(fmt::format("substr: start {} is out of range", start));
+
+            if (length < 0)
+                throw LogicalError(fmt::format("substr: length {} is negative", length));
+
+            // The substring stops at the end of the string, like std::string::substr
+            return Object(s.substr(std::size_t(start), std::size_t(length)));
+        }
+    ));
+
+    builtins.add(Builtin::create("min", {{"a", Token::INT_TYPE}, {"b", Token::INT_TYPE}}, Token::INT_TYPE,
+        [](Arguments args) {
+            return Object(std::min(args[0].getInteger(), args[1].getInteger()));
+        }
+    ));
+
+    builtins.add(Builtin::create("max", {{"a", Token::INT_TYPE}, {"b", Token::INT_TYPE}}, Token::INT_TYPE,
+        [](Arguments args) {
+            return Object(std::max(args[0].getInteger(), args[1].getInteger()));
+        }
+    ));
+
+    builtins.add(Builtin::create("abs", {{"n", Token::INT_TYPE}}, Token::INT_TYPE, [](Arguments args) {
+        auto n = args[0].getInteger();
+
+        // Its opposite isn't representable
+        if (n == std::numeric_limits<Token::Integer>::min())
+            throw LogicalError(fmt::format("abs: {} has no representable absolute value", n));
+
+        return Object(n < 0 ? -n : n);
+    }));
+
+    builtins.add(Builtin::create("parseInt", {{"s", Token::STR_TYPE}}, Token::INT_TYPE, [](Arguments args) {
+        const auto &s = args[0].get<Token::String>();
+        Token::Integer value = 0;
+        auto [end, error] = std::from_chars(s.data(), s.data() + s.size(), value);
+
+        if (s.empty() || error != std::errc() || end != s.data() + s.size())
+            throw LogicalError(fmt::format("parseInt: \"{}\" is not an integer", s));
+
+        return Object(value);
+    }));
+
+    builtins.add(Builtin::create("toString", {{"n", Token::INT_TYPE}}, Token::STR_TYPE, [](Arguments args) {
+        return Object(fmt::format("{}", args[0].getInteger()));
+    }));
+
+    return builtins;
+}
+
+void runtime::Builtins::add(const runtime::Builtin::ptr &builtin)
+{
+    auto found = std::find_if(this->_functions.begin(), this->_functions.end(), [&](const auto &function) {
+        return function->getIdentifier() == builtin->getIdentifier();
+    });
+
+    if (found != this->_functions.end())
+        *found = builtin;
+    else
+        this->_functions.push_back(builtin);
+}
+
+void runtime::Builtins::bind(runtime::State &state) const
+{
+    for (const auto &builtin : this->_functions)
+        bind(state, builtin);
+}
+
+void runtime::Builtins::bind(runtime::State &state, const runtime::Builtin::ptr &builtin)
+{
+    const auto &identifier = builtin->getIdentifier();
+
+    state.set(state.resolve(identifier), identifier, Object(builtin));
+}
+
+const std::vector<runtime::Builtin::ptr> &runtime::Builtins::getFunctions() const noexcept
+{
+    return this->_functions;
+}
@@ -0,0 +1,62 @@
+#include <new>
+
+#include "FramePool.hpp"
+
+runtime::FramePool::ptr runtime::FramePool::create()
+{
+    return std::make_shared<FramePool>();
+}
+
+runtime::FramePool::~FramePool()
+{
+    for (std::size_t sizeClass = 0; sizeClass < CLASSES_COUNT; sizeClass++) {
+        auto *block = this->_freeBlocks[sizeClass];
+
+        while (block) {
+            auto *next = block->next;
+
+            ::operator delete(block, (sizeClass + 1) * CLASS_SIZE);
+            block = next;
+        }
+    }
+}
+
+void *runtime::FramePool::allocate(std::size_t size, std::size_t alignment)
+{
+    auto sizeClass = classOf(size, alignment);
+
+    if (sizeClass == CLASSES_COUNT)
+        return ::operator new(size, std::align_val_t(alignment));
+
+    auto *block = this->_freeBlocks[sizeClass];
+
+    if (!block)
+        return ::operator new((sizeClass + 1) * CLASS_SIZE);
+
+    this->_freeBlocks[sizeClass] = block->next;
+
+    return block;
+}
+
+void runtime::FramePool::deallocate(void *memory, std::size_t size, std::size_t alignment) noexcept
+{
+    auto sizeClass = classOf(size, alignment);
+
+    if (sizeClass == CLASSES_COUNT) {
+        ::operator delete(memory, size, std::align_val_t(alignment));
+        return;
+    }
+
+    auto *block = static_cast<Block *>(memory);
+
+    block->next = this->_freeBlocks[sizeClass];
+    this->_freeBlocks[sizeClass] = block;
+}
+
+std::size_t runtime::FramePool::classOf(std::size_t size, std::size_t alignment) noexcept
+{
+    if (!size || alignment > CLASS_SIZE || size > CLASSES_COUNT * CLASS_SIZE)
+        return CLASSES_COUNT;
+
+    return (size - 1) / CLASS_SIZE;
+}
@@ -0,0 +1,114 @@
+#include <cstdint>
+#include <exception>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "NativeStack.hpp"
+#include "InterpreterError.hpp"
+
+namespace
+{
+    struct Task
+    {
+        const std::function<void()> &function;
+        std::exception_ptr error;
+    };
+
+    // Task started on the native stack, contexts can't be given pointers portably
+    thread_local Task *startedTask = nullptr;
+
+    // Lowest address the native stack being run on may grow to, 0 outside of it
+    thread_local std::uintptr_t nativeLimit = 0;
+
+    void runTask()
+    {
+        auto &task = *startedTask;
+
+        // Exceptions can't unwind past the start of a context
+        try {
+            task.function();
+        } catch (...) {
+            task.error = std::current_exception();
+        }
+    }
+
+    // Lowest address the stack of the calling thread may grow to, or 0 if it can't be found
+    std::uintptr_t threadLimit() noexcept
+    {
+#if defined(__APPLE__)
+        auto *self = pthread_self();
+        auto top = reinterpret_cast<std::uintptr_t>(pthread_get_stackaddr_np(self));
+
+        return top - pthread_get_stacksize_np(self) + runtime::NativeStack::RESERVE;
+#else
+        pthread_attr_t attributes;
+        void *address = nullptr;
+        std::size_t size = 0;
+
+        if (pthread_getattr_np(pthread_self(), &attributes) != 0)
+            return 0;
+
+        auto found = pthread_attr_getstack(&attributes, &address, &size) == 0;
+
+        pthread_attr_destroy(&attributes);
+
+        if (!found || size <= runtime::NativeStack::RESERVE)
+            return 0;
+
+        return reinterpret_cast<std::uintptr_t>(address) + runtime::NativeStack::RESERVE;
+#endif
+    }
+}
+
+void runtime::NativeStack::run(const std::function<void()> &task)
+{
+    if (nativeLimit)
+        return task();
+
+    auto *stack = mmap(nullptr, SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (stack == MAP_FAILED)
+        throw InternalError("native stack could not be allocated");
+
+    // Overflowing the reserve faults on the guard page rather than writing past the stack
+    auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    ucontext_t caller;
+    ucontext_t callee;
+    Task running{task, nullptr};
+
+    if (mprotect(stack, pageSize, PROT_NONE) != 0 || getcontext(&callee) != 0) {
+        munmap(stack, SIZE);
+        throw InternalError("native stack could not be prepared");
+    }
+
+    callee.uc_stack.ss_sp = stack;
+    callee.uc_stack.ss_size = SIZE;
+    callee.uc_link = &caller;
+    makecontext(&callee, runTask, 0);
+
+    startedTask = &running;
+    nativeLimit = reinterpret_cast<std::uintptr_t>(stack) + pageSize + RESERVE;
+
+    auto switched = swapcontext(&caller, &callee) == 0;
+
+    nativeLimit = 0;
+    munmap(stack, SIZE);
+
+    if (!switched)
+        throw InternalError("native stack could not be switched to");
+
+    if (running.error)
+        std::rethrow_exception(running.error);
+}
+
+bool runtime::NativeStack::exhausted() noexcept
+{
+    // The stack grows down on every supported platform
+    thread_local auto ownLimit = threadLimit();
+    auto limit = nativeLimit ? nativeLimit : ownLimit;
+    char marker = 0;
+
+    return reinterpret_cast<std::uintptr_t>(&marker) < limit;
+}
@@ -4,68 +4,56 @@
 #include "Object.hpp"
 
 runtime::Object::Object()
-    :   _identifier(),
-        _type(Token::Type(-1)),
-        _raw()
+    :   _type(Token::Type(-1)),
+        _value()
 {
 }
 
-runtime::Object::Object(Token::Type type, std::string identifier)
-    :   _identifier(std::move(identifier)),
-        _type(type)
+runtime::Object::Object(Token::Type type)
+    :   _type(type)
 {
+    static const auto emptyString = std::make_shared<const Token::String>();
+
     switch (type) {
-        case Token::INT_TYPE: this->_raw = Token::Integer(0);   break;
-        case Token::STR_TYPE: this->_raw = Token::String();     break;
+        case Token::INT_TYPE: this->_value = Token::Integer(0);  break;
+        case Token::STR_TYPE: this->_value = emptyString;        break;
         default:
             throw InternalError("invalid type");
     }
 }
 
-runtime::Object::Object(Token::Integer i, std::string identifier)
-:   _identifier(std::move(identifier)),
-    _type(Token::INT_TYPE),
-    _raw(i)
+runtime::Object::Object(Token::Integer i)
+:   _type(Token::INT_TYPE),
+    _value(i)
 {}
 
-runtime::Object::Object(Token::String s, std::string identifier)
-:   _identifier(std::move(identifier)),
-    _type(Token::STR_TYPE),
-    _raw(std::move(s))
+runtime::Object::Object(Token::String s)
+:   _type(Token::STR_TYPE),
+    _value(std::make_shared<const Token::String>(std::move(s)))
 {
 }
 
-runtime::Object::Object(const ast::FunctionNode &function)
-:   _identifier(function.getIdentifier()),
-    _type(Token::FNC_TYPE),
-    _raw(function)
+runtime::Object::Object(std::shared_ptr<const ast::FunctionNode> function)
+:   _type(Token::FNC_TYPE),
+    _value(std::move(function))
 {}
 
-const std::string &runtime::Object::getIdentifier() const
-{
-    return this->_identifier;
-}
-
-Token::Type runtime::Object::getType() const
-{
-    return this->_type;
-}
-
-Token::Integer runtime::Object::getInteger() const
-{
-    if (this->_type != Token::INT_TYPE)
-        throw InternalError("token type is not integer");
+runtime::Object::Object(std::shared_ptr<const vm::Function> function)
+:   _type(Token::FNC_TYPE),
+    _value(std::move(function))
+{}
 
-    return std::any_cast<Token::Integer>(this->_raw);
-}
+runtime::Object::Object(std::shared_ptr<const Builtin> builtin)
+:   _type(Token::FNC_TYPE),
+    _value(std::move(builtin))
+{}
 
 std::string runtime::Object::string() const noexcept
 {
-    const auto &identifier = this->_identifier;
     const auto &type = Token::typeToString(this->_type);
     const auto &value = this->getValueAsString();
 
-    return fmt::format("{{identifier={}, type={}, value={}}}", identifier, type, value);
+    return fmt::format("{{type={}, value={}}}", type, value);
 }
 
 std::string runtime::Object::getValueAsString() const noexcept
@@ -0,0 +1,104 @@
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <unistd.h>
+
+#include "Output.hpp"
+
+#define OUTPUT_BUFFER_SIZE (64 * 1024)
+
+// Longest integer representation, sign included
+#define INTEGER_MAX_SIZE (std::numeric_limits<Token::Integer>::digits10 + 2)
+
+runtime::Output::ptr runtime::Output::create(std::ostream &stream)
+{
+    auto interactive = &stream == &std::cout && isatty(STDOUT_FILENO);
+
+    return create(stream, interactive ? FlushPolicy::LINE : FlushPolicy::FULL);
+}
+
+runtime::Output::ptr runtime::Output::create(std::ostream &stream, runtime::Output::FlushPolicy policy)
+{
+    return std::make_shared<Output>(stream, policy);
+}
+
+runtime::Output::Output(std::ostream &stream, runtime::Output::FlushPolicy policy)
+:   _stream(stream),
+    _policy(policy),
+    _buffer(OUTPUT_BUFFER_SIZE),
+    _size(0)
+{}
+
+runtime::Output::~Output()
+{
+    try {
+        this->flush();
+    } catch (...) {}
+}
+
+void runtime::Output::write(const runtime::Object &object)
+{
+    switch (object.getType()) {
+        case Token::INT_TYPE:
+            return this->write(object.getInteger());
+
+        case Token::STR_TYPE:
+            return this->write(std::string_view(object.get<Token::String>()));
+
+        default:
+            return this->write(std::string_view("null"));
+    }
+}
+
+void runtime::Output::write(Token::Integer i)
+{
+    auto *begin = this->reserve(INTEGER_MAX_SIZE);
+    auto [end, error] = std::to_chars(begin, begin + INTEGER_MAX_SIZE, i);
+
+    this->_size += end - begin;
+}
+
+void runtime::Output::write(std::string_view s)
+{
+    // Strings which don't fit in the buffer bypass it
+    if (s.size() > this->_buffer.size()) {
+        this->flush();
+        this->_stream.write(s.data(), std::streamsize(s.size()));
+        return;
+    }
+
+    std::memcpy(this->reserve(s.size()), s.data(), s.size());
+    this->_size += s.size();
+}
+
+void runtime::Output::endLine()
+{
+    *this->reserve(1) = '\n';
+    this->_size++;
+
+    if (this->_policy == FlushPolicy::LINE)
+        this->flush();
+}
+
+void runtime::Output::flush()
+{
+    if (this->_size) {
+        this->_stream.write(this->_buffer.data(), std::streamsize(this->_size));
+        this->_size = 0;
+    }
+
+    this->_stream.flush();
+}
+
+runtime::Output::FlushPolicy runtime::Output::getFlushPolicy() const noexcept
+{
+    return this->_policy;
+}
+
+char *runtime::Output::reserve(std::size_t size)
+{
+    if (this->_size + size > this->_buffer.size())
+        this->flush();
+
+    return this->_buffer.data() + this->_size;
+}
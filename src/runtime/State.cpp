@@ -1,46 +1,184 @@
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <utility>
 
 #include "State.hpp"
 
-std::optional<std::reference_wrapper<runtime::Object>> runtime::State::tryFind(const std::string &identifier) noexcept
+#define NO_BUILTIN_SLOT (std::size_t(-1))
+
+runtime::Object &runtime::State::find(const runtime::Address &address, const std::string &identifier)
 {
-    const auto &found = this->_state.find(identifier);
+    auto *found = this->lookup(address, identifier);
 
-    if (found == this->_state.end()) {
-        if (this->_parent)
-            return this->_parent->tryFind(identifier);
+    if (!found)
+        throw LogicalError(fmt::format("{}: undefined identifier", identifier));
 
-        return {};
+    return *found;
+}
+
+const runtime::Object &runtime::State::load(const runtime::Address &address, const std::string &identifier)
+{
+    if (const auto *found = this->lookup(address, identifier))
+        return *found;
+
+    auto &global = *this->_global;
+
+    if (address.depth == Address::GLOBAL)
+        return global.loadBuiltin(address.slot, identifier);
+
+    const auto &symbol = global._symbols.find(identifier);
+
+    if (symbol == global._symbols.end())
+        throw LogicalError(fmt::format("{}: undefined identifier", identifier));
+
+    return global.loadBuiltin(symbol->second, identifier);
+}
+
+runtime::Object *runtime::State::lookup(const runtime::Address &address, const std::string &identifier)
+{
+    if (address.depth == Address::GLOBAL) {
+        auto &global = *this->_global;
+
+        // Unless a local scope declares the identifier, no caller can shadow the global
+        if (address.dynamic && (global.getUsage(address.slot) & DECLARED_LOCALLY))
+            return this->search(identifier);
+
+        if (address.slot >= global._slots.size() || global._slots[address.slot].isNull())
+            return nullptr;
+
+        return &global._slots[address.slot];
     }
 
-    return std::make_optional(std::ref(*found->second));
+    auto &state = this->ancestor(address.depth);
+
+    if (address.slot >= state._slots.size())
+        throw InternalError("State invoked with a slot out of scope");
+
+    auto &slot = state._slots[address.slot];
+
+    // The declaration of the slot wasn't executed (yet), so an outer variable is read instead
+    if (slot.isNull())
+        return this->search(identifier);
+
+    return &slot;
 }
 
-runtime::Object &runtime::State::find(const std::string &identifier)
+runtime::Object *runtime::State::search(const std::string &identifier) noexcept
 {
-    auto found = this->tryFind(identifier);
+    for (auto *state = this; state->_layout; state = state->_parent.get()) {
+        const auto &layout = *state->_layout;
 
-    if (!found)
-        throw LogicalError(fmt::format("{}: undefined identifier", identifier));
+        for (std::size_t slot = 0; slot < layout.size(); slot++)
+            if (layout[slot] == identifier && !state->_slots[slot].isNull())
+                return &state->_slots[slot];
+    }
+
+    auto &global = *this->_global;
+    const auto &found = global._symbols.find(identifier);
+
+    if (found == global._symbols.end() || global._slots[found->second].isNull())
+        return nullptr;
 
-    return found.value().get();
+    return &global._slots[found->second];
 }
 
-void runtime::State::set(const std::string &identifier, const runtime::Object &object)
+runtime::State &runtime::State::ancestor(std::size_t depth)
 {
-    const auto &found = this->_state.find(identifier);
+    auto *state = this;
+
+    for (std::size_t i = 0; i < depth; i++) {
+        state = state->_parent.get();
+
+        if (!state)
+            throw InternalError("State invoked with an address out of scopes");
+    }
+
+    return *state;
+}
+
+const runtime::Object &runtime::State::loadBuiltin(std::size_t slot, const std::string &identifier)
+{
+    // Only the global state both keeps track of identifiers and has a parent, the state of the builtins.
+    // Whether a global shadows a builtin is only known when it is read, since programs may define it at any time.
+    if (this->_parent && slot < this->_slots.size() && !this->_symbols.empty()) {
+        if (slot >= this->_builtinSlots.size())
+            this->_builtinSlots.resize(slot + 1, NO_BUILTIN_SLOT);
+
+        auto &builtinSlot = this->_builtinSlots[slot];
+        const auto &builtins = *this->_parent;
+
+        // Builtins are never undefined, so the slot of one which was found is kept
+        if (builtinSlot == NO_BUILTIN_SLOT) {
+            const auto &found = builtins._symbols.find(identifier);
 
-    if (found != this->_state.end())
+            if (found != builtins._symbols.end() && !builtins._slots[found->second].isNull())
+                builtinSlot = found->second;
+        }
+
+        if (builtinSlot != NO_BUILTIN_SLOT)
+            return builtins._slots[builtinSlot];
+    }
+
+    throw LogicalError(fmt::format("{}: undefined identifier", identifier));
+}
+
+void runtime::State::set(std::size_t slot, const std::string &identifier, const runtime::Object &object)
+{
+    if (slot >= this->_slots.size())
+        throw InternalError("State::set invoked with a slot out of scope");
+
+    auto &current = this->_slots[slot];
+
+    if (!current.isNull())
         throw LogicalError(fmt::format("{}: identifier already defined", identifier));
 
-    this->_state.insert({identifier, std::make_unique<Object>(object)});
+    current = object;
+}
+
+std::size_t runtime::State::resolve(const std::string &identifier)
+{
+    const auto &found = this->_symbols.find(identifier);
+
+    if (found != this->_symbols.end())
+        return found->second;
+
+    this->_slots.emplace_back();
+    this->_usages.push_back(0);
+    this->_symbols.insert({identifier, this->_slots.size() - 1});
+
+    return this->_slots.size() - 1;
+}
+
+const std::unordered_map<std::string, std::size_t> &runtime::State::getSymbols() const noexcept
+{
+    return this->_symbols;
+}
+
+void runtime::State::use(std::size_t slot, uint8_t usage)
+{
+    if (slot >= this->_usages.size())
+        throw InternalError("State::use invoked with a slot out of scope");
+
+    this->_usages[slot] |= usage;
+}
+
+uint8_t runtime::State::getUsage(std::size_t slot) const noexcept
+{
+    return slot < this->_usages.size() ? this->_usages[slot] : 0;
+}
+
+bool runtime::State::isLookedUp(const std::vector<std::size_t> &slots) const noexcept
+{
+    return std::any_of(slots.begin(), slots.end(), [this](auto slot) { return this->getUsage(slot) & LOOKED_UP; });
 }
 
 void runtime::State::clear() noexcept
 {
-    this->_state.clear();
+    this->_slots.clear();
+    this->_symbols.clear();
+    this->_usages.clear();
+    this->_builtinSlots.clear();
 }
 
 runtime::State::~State()
@@ -50,30 +188,39 @@ runtime::State::~State()
 
 std::optional<runtime::Object> runtime::State::get(const std::string &identifier) const noexcept
 {
-    const auto &found = this->_state.find(identifier);
+    const auto &found = this->_symbols.find(identifier);
 
-    if (found == this->_state.end())
+    if (found == this->_symbols.end() || this->_slots[found->second].isNull())
         return {};
 
-    return {*found->second};
+    return {this->_slots[found->second]};
 }
 
-runtime::State::ptr runtime::State::create(const runtime::State::ptr& parent)
+runtime::State::ptr runtime::State::create(const runtime::State::ptr &parent)
 {
-    if (parent) {
-        return std::make_shared<State>(parent);
-    }
+    auto pool = parent ? parent->getPool() : FramePool::create();
 
-    return std::make_shared<State>();
+    return std::allocate_shared<State>(FramePool::Allocator<State>(pool), parent, nullptr, pool);
 }
 
-runtime::State::State(runtime::State::ptr parent)
-:   _parent(std::move(parent))
+runtime::State::ptr runtime::State::create(const runtime::State::ptr &parent, const runtime::Layout &layout)
 {
+    if (!parent)
+        throw InternalError("State::create invoked with a layout and a null parent");
+
+    auto pool = parent->getPool();
+
+    return std::allocate_shared<State>(FramePool::Allocator<State>(pool), parent, &layout, pool);
 }
 
-runtime::State::State()
-:   _parent(nullptr)
+runtime::State::State(runtime::State::ptr parent, const runtime::Layout *layout, const runtime::FramePool::ptr &pool)
+:   _slots(layout ? layout->size() : 0, FramePool::Allocator<Object>(pool)),
+    _symbols(),
+    _parent(std::move(parent)),
+    _layout(layout),
+    _global(layout ? this->_parent->_global : this),
+    _usages(),
+    _builtinSlots()
 {
 }
 
@@ -88,3 +235,13 @@ runtime::State::ptr runtime::State::restoreParent()
 
     return parent;
 }
+
+const runtime::State::ptr &runtime::State::getParent() const noexcept
+{
+    return this->_parent;
+}
+
+runtime::FramePool::ptr runtime::State::getPool() const noexcept
+{
+    return this->_slots.get_allocator().getPool();
+}
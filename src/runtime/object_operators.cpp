@@ -4,30 +4,14 @@ runtime::Object runtime::Object::operator%(const Object &right) const
 {
     assertTypesEqual(right, Token::INT_TYPE);
 
-    auto l = this->getInteger();
-    auto r = right.getInteger();
-
-    if (!r)
-        throw LogicalError("modulo by zero");
-
-    auto result = l % r;
-
-    return result;
+    return modulo(this->getInteger(), right.getInteger());
 }
 
 runtime::Object runtime::Object::operator/(const runtime::Object &right) const
 {
     assertTypesEqual(right, Token::INT_TYPE);
 
-    auto l = this->getInteger();
-    auto r = right.getInteger();
-
-    if (!r)
-        throw LogicalError("division by zero");
-
-    auto result = l / r;
-
-    return result;
+    return divide(this->getInteger(), right.getInteger());
 }
 
 runtime::Object runtime::Object::operator*(const runtime::Object &right) const
@@ -183,6 +167,98 @@ runtime::Object runtime::Object::operator~() const
     return ~this->getInteger();
 }
 
+runtime::Object runtime::Object::apply(Token::Type oprt, const runtime::Object &right) const
+{
+    switch (oprt) {
+        case Token::MOD:            return *this % right;
+        case Token::DIV:            return *this / right;
+        case Token::MULT:           return *this * right;
+        case Token::PLUS:           return *this + right;
+        case Token::MINUS:          return *this - right;
+        case Token::EQUAL:          return *this == right;
+        case Token::NOT_EQUAL:      return *this != right;
+        case Token::GT:             return *this > right;
+        case Token::GTE:            return *this >= right;
+        case Token::LT:             return *this < right;
+        case Token::LTE:            return *this <= right;
+        case Token::BITWISE_OR:     return *this | right;
+        case Token::BITWISE_XOR:    return *this ^ right;
+        case Token::BITWISE_AND:    return *this & right;
+        case Token::BITWISE_LSHIFT: return *this << right;
+        case Token::BITWISE_RSHIFT: return *this >> right;
+
+        default:
+            throw InternalError("Object: unknown binary operator");
+    }
+}
+
+runtime::Object runtime::Object::apply(Token::Type oprt) const
+{
+    switch (oprt) {
+        case Token::PLUS:           return +*this;
+        case Token::MINUS:          return -*this;
+        case Token::NOT:            return !*this;
+        case Token::BITWISE_NOT:    return ~*this;
+
+        default:
+            throw InternalError("Object: unknown unary operator");
+    }
+}
+
+Token::Integer runtime::Object::apply(Token::Type oprt, Token::Integer left, Token::Integer right)
+{
+    switch (oprt) {
+        case Token::MOD:            return modulo(left, right);
+        case Token::DIV:            return divide(left, right);
+        case Token::MULT:           return left * right;
+        case Token::PLUS:           return left + right;
+        case Token::MINUS:          return left - right;
+        case Token::EQUAL:          return left == right;
+        case Token::NOT_EQUAL:      return left != right;
+        case Token::GT:             return left > right;
+        case Token::GTE:            return left >= right;
+        case Token::LT:             return left < right;
+        case Token::LTE:            return left <= right;
+        case Token::BITWISE_OR:     return left | right;
+        case Token::BITWISE_XOR:    return left ^ right;
+        case Token::BITWISE_AND:    return left & right;
+        case Token::BITWISE_LSHIFT: return left << right;
+        case Token::BITWISE_RSHIFT: return left >> right;
+
+        default:
+            throw InternalError("Object: unknown binary operator");
+    }
+}
+
+Token::Integer runtime::Object::apply(Token::Type oprt, Token::Integer value)
+{
+    switch (oprt) {
+        case Token::PLUS:           return +value;
+        case Token::MINUS:          return -value;
+        case Token::NOT:            return !value;
+        case Token::BITWISE_NOT:    return ~value;
+
+        default:
+            throw InternalError("Object: unknown unary operator");
+    }
+}
+
+Token::Integer runtime::Object::divide(Token::Integer left, Token::Integer right)
+{
+    if (!right)
+        throw LogicalError("division by zero");
+
+    return left / right;
+}
+
+Token::Integer runtime::Object::modulo(Token::Integer left, Token::Integer right)
+{
+    if (!right)
+        throw LogicalError("modulo by zero");
+
+    return left % right;
+}
+
 runtime::Object::operator bool() const
 {
     assertTypeEqual(Token::INT_TYPE);
@@ -195,7 +271,7 @@ runtime::Object &runtime::Object::assign(const runtime::Object &rv)
 {
     assertTypeEqual(rv.getType());
 
-    this->_raw = rv._raw;
+    this->_value = rv._value;
 
     return *this;
 }
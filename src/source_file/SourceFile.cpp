@@ -1,13 +1,30 @@
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <fmt/format.h>
-#include <sstream>
 
 #include "SourceFile.hpp"
 
+#define READ_SIZE (64 * 1024)
+
 SourceFile::SourceFile(const std::string &filePath)
 :   _filePath(filePath),
-    _sourceContent(readFile(filePath))
-{}
+    _mapping(nullptr),
+    _mappingSize(0),
+    _buffer(),
+    _sourceContent()
+{
+    this->readFile();
+}
 
+SourceFile::~SourceFile()
+{
+    if (this->_mapping)
+        munmap(this->_mapping, this->_mappingSize);
+}
 
 void SourceFile::interpret(Evaluator &evaluator)
 {
@@ -18,24 +35,86 @@ void SourceFile::interpret(Evaluator &evaluator)
     }
 }
 
-std::string SourceFile::readFile(const std::string &filePath)
+void SourceFile::interpretCached(Evaluator &evaluator)
 {
-    std::ifstream source;
-    std::ostringstream oss;
-
-    source.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    auto cache = vm::Cache::locate(this->_filePath, this->_sourceContent);
 
     try {
-        source.open(filePath);
-        oss << source.rdbuf();
-    } catch (const std::system_error& e) {
-        throw InterpreterError(
-            "FileSystem",
-            fmt::format("failed to open {} : {}", filePath, e.what())
-        );
+        evaluator.feed(this->_sourceContent, cache);
+    } catch (const InterpreterError &err) {
+        throw InterpreterError(this->_filePath, err);
+    }
+}
+
+static InterpreterError fileSystemError(const std::string &filePath)
+{
+    return {"FileSystem", fmt::format("failed to open {} : {}", filePath, std::strerror(errno))};
+}
+
+void SourceFile::readFile()
+{
+    int fd = open(this->_filePath.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        throw fileSystemError(this->_filePath);
+
+    struct stat status{};
+
+    if (fstat(fd, &status) < 0) {
+        auto error = fileSystemError(this->_filePath);
+        close(fd);
+        throw error;
     }
 
+    // Empty files can't be mapped, and are read like streams
+    if (S_ISREG(status.st_mode) && status.st_size > 0) {
+        auto size = std::size_t(status.st_size);
+        auto *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
 
-    return oss.str();
+        if (mapping != MAP_FAILED) {
+            madvise(mapping, size, MADV_SEQUENTIAL);
+
+            this->_mapping = mapping;
+            this->_mappingSize = size;
+            this->_sourceContent = std::string_view(static_cast<const char *>(mapping), size);
+
+            close(fd);
+            return;
+        }
+    }
+
+    try {
+        this->readStream(fd);
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+
+    close(fd);
 }
 
+void SourceFile::readStream(int fd)
+{
+    for (;;) {
+        auto size = this->_buffer.size();
+
+        this->_buffer.resize(size + READ_SIZE);
+
+        auto count = read(fd, this->_buffer.data() + size, READ_SIZE);
+
+        if (count < 0 && errno == EINTR) {
+            this->_buffer.resize(size);
+            continue;
+        }
+
+        if (count < 0)
+            throw fileSystemError(this->_filePath);
+
+        this->_buffer.resize(size + std::size_t(count));
+
+        if (!count)
+            break;
+    }
+
+    this->_sourceContent = this->_buffer;
+}
@@ -6,11 +6,12 @@ set(SOURCES
     ${PROJECT_ROOT}/src/lexer/lexLiterals.cpp
     ${PROJECT_ROOT}/src/lexer/lexOperator.cpp
     ${PROJECT_ROOT}/src/lexer/lexProgrammingWord.cpp
+    ${PROJECT_ROOT}/src/lexer/scan.cpp
 
     ${PROJECT_ROOT}/src/parser/Parser.cpp
 
     ${PROJECT_ROOT}/src/token/token.cpp
-    ${PROJECT_ROOT}/src/token/iterator.cpp
+    ${PROJECT_ROOT}/src/token/buffer.cpp
     ${PROJECT_ROOT}/src/token/type.cpp
 
     ${PROJECT_ROOT}/src/evaluator/Evaluator.cpp
@@ -19,6 +20,8 @@ set(SOURCES
 
     ${PROJECT_ROOT}/src/error/InterpreterError.cpp
 
+    ${PROJECT_ROOT}/src/ast/Arena.cpp
+
     ${PROJECT_ROOT}/src/ast/nodes/IntegerNode.cpp
     ${PROJECT_ROOT}/src/ast/nodes/BinaryNode.cpp
     ${PROJECT_ROOT}/src/ast/nodes/UnaryNode.cpp
@@ -43,10 +46,24 @@ set(SOURCES
     ${PROJECT_ROOT}/src/ast/nodes/ContinueNode.cpp
 
     ${PROJECT_ROOT}/src/ast/visitors/EvalVisitor.cpp
+    ${PROJECT_ROOT}/src/ast/visitors/ResolveVisitor.cpp
+    ${PROJECT_ROOT}/src/ast/visitors/CompileVisitor.cpp
+    ${PROJECT_ROOT}/src/ast/visitors/FoldVisitor.cpp
+    ${PROJECT_ROOT}/src/ast/visitors/TypeVisitor.cpp
+
+    ${PROJECT_ROOT}/src/vm/Chunk.cpp
+    ${PROJECT_ROOT}/src/vm/Function.cpp
+    ${PROJECT_ROOT}/src/vm/VirtualMachine.cpp
+    ${PROJECT_ROOT}/src/vm/Cache.cpp
 
     ${PROJECT_ROOT}/src/runtime/Object.cpp
     ${PROJECT_ROOT}/src/runtime/object_operators.cpp
     ${PROJECT_ROOT}/src/runtime/State.cpp
+    ${PROJECT_ROOT}/src/runtime/FramePool.cpp
+    ${PROJECT_ROOT}/src/runtime/NativeStack.cpp
+    ${PROJECT_ROOT}/src/runtime/Builtin.cpp
+    ${PROJECT_ROOT}/src/runtime/Builtins.cpp
+    ${PROJECT_ROOT}/src/runtime/Output.cpp
     ${PROJECT_ROOT}/src/runtime/Jump.cpp
     ${PROJECT_ROOT}/src/runtime/Break.cpp
     ${PROJECT_ROOT}/src/runtime/Continue.cpp
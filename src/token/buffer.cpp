@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <utility>
+
+#include "token.hpp"
+
+Token::Buffer::Buffer(std::vector<Token> tokens)
+:   _tokens(std::move(tokens)),
+    _index(0)
+{
+}
+
+Token::Buffer &Token::Buffer::reset(std::vector<Token> &tokens)
+{
+    this->_tokens.swap(tokens);
+    this->_index = 0;
+    this->_exhausted = false;
+    tokens.clear();
+    return *this;
+}
+
+const Token *Token::Buffer::peek(long offset) const noexcept
+{
+    // Unsigned wrap around makes positions before the first token out of the buffer as well
+    auto index = this->_index + std::size_t(offset);
+
+    if (index >= this->_tokens.size()) {
+        this->_exhausted |= offset >= 0;
+        return nullptr;
+    }
+
+    return &this->_tokens[index];
+}
+
+const Token *Token::Buffer::get() const noexcept
+{
+    return this->peek(0);
+}
+
+const Token *Token::Buffer::next() const noexcept
+{
+    return this->peek(1);
+}
+
+const Token *Token::Buffer::prev() const noexcept
+{
+    return this->peek(-1);
+}
+
+Token::Buffer &Token::Buffer::advance(std::size_t count)
+{
+    // Moves one step past the last token at most, so prev() is empty once the end has been reached twice.
+    this->_index = std::min(this->_index + count, this->_tokens.size() + 1);
+
+    return *this;
+}
+
+std::size_t Token::Buffer::mark() noexcept
+{
+    this->_exhausted = false;
+
+    return this->_index;
+}
+
+void Token::Buffer::rewind(std::size_t position) noexcept
+{
+    this->_index = position;
+}
+
+bool Token::Buffer::isExhausted() const noexcept
+{
+    return this->_exhausted;
+}
+
+std::size_t Token::Buffer::size() const noexcept
+{
+    return this->_tokens.size();
+}
@@ -1,13 +1,14 @@
 #include "token.hpp"
 
 #include <utility>
+#include <algorithm>
+#include <charconv>
 
-Token::Token(Token::Type type, const std::string &lexeme, std::size_t line, std::size_t column)
+Token::Token(Token::Type type, std::string_view lexeme, std::size_t line, std::size_t column)
 :   _type(type),
-    _lexeme(lexeme),
-    _literalValue(literalFromLexeme(type, lexeme)),
     _line(line),
-    _column(column)
+    _column(column),
+    _lexeme(lexeme)
 {}
 
 Token::Type Token::getType() const noexcept
@@ -20,7 +21,7 @@ bool Token::isType(Token::Type type) const noexcept
     return this->_type == type;
 }
 
-bool Token::isTypeAnyOf(const std::initializer_list<Token::Type> &types)
+bool Token::isTypeAnyOf(const std::initializer_list<Token::Type> &types) const
 {
     return Token::isTypeAnyOf(this->_type, types);
 }
@@ -30,53 +31,39 @@ Token::Integer Token::getIntegerLiteral() const
     if (this->_type != INTEGER)
         throw InternalError("token type is not integer");
 
-    return this->getLiteral<Integer>();
+    return Token::integerFromLexeme(this->_lexeme);
 }
 
-bool Token::operator==(const Token &other) const
+Token::String Token::getStringLiteral() const
 {
-    if (this->_type != other.getType())
-        return false;
-
-    if (this->_lexeme != other._lexeme)
-        return false;
+    if (this->_type != STRING)
+        throw InternalError("token type is not string");
 
-    switch (this->_type) {
-        case Token::INTEGER:
-            return this->getLiteral<Integer>() == other.getLiteral<Integer>();
-        case Token::STRING:
-            return this->getLiteral<String>() == other.getLiteral<String>();
-        default:
-            return true;
-    }
+    return Token::stringFromLexeme(this->_lexeme);
 }
 
-std::any Token::literalFromLexeme(Token::Type type, const std::string &lexeme)
+bool Token::operator==(const Token &other) const
 {
-    switch (type) {
-        case INTEGER:
-            return Token::integerFromLexeme(lexeme);
-        case STRING:
-            return Token::stringFromLexeme(lexeme);
-        default:
-            return nullptr;
-    }
+    if (this->_type != other.getType())
+        return false;
+
+    // Literal values are decoded from lexemes, so equal lexemes have equal values.
+    return this->_lexeme == other._lexeme;
 }
 
-Token::Integer Token::integerFromLexeme(const std::string &lexeme)
+Token::Integer Token::integerFromLexeme(std::string_view lexeme)
 {
-    Token::Integer value;
+    Token::Integer value = 0;
+    const auto *end = lexeme.data() + lexeme.size();
+    const auto [ptr, error] = std::from_chars(lexeme.data(), end, value);
 
-    try {
-        value = std::stoi(lexeme);
-    } catch (...) {
+    if (error != std::errc() || ptr != end)
         throw InternalError(fmt::format("\"{}\" : not an integer", lexeme));
-    }
 
     return value;
 }
 
-Token::String Token::stringFromLexeme(const std::string &lexeme)
+Token::String Token::stringFromLexeme(std::string_view lexeme)
 {
     String escaped;
 
@@ -119,7 +106,7 @@ bool Token::isTypeAnyOf(Token::Type type, const std::initializer_list<Token::Typ
     });
 }
 
-const std::string &Token::getLexeme() const noexcept
+std::string_view Token::getLexeme() const noexcept
 {
     return this->_lexeme;
 }
@@ -133,8 +120,3 @@ std::size_t Token::getColumn() const noexcept
 {
     return this->_column;
 }
-
-Token::ptr Token::create(Token::Type type, const std::string &lexeme, std::size_t line, std::size_t column)
-{
-    return std::make_shared<Token>(type, lexeme, line, column);
-}
@@ -40,3 +40,17 @@ bool Token::isAssignableOperator() const noexcept
 {
     return Token::isAssignableOperator(this->_type);
 }
+
+Token::Type Token::compoundOperator(Token::Type type)
+{
+    switch (type) {
+        case Token::PLUS_GN:    return Token::PLUS;
+        case Token::MINUS_GN:   return Token::MINUS;
+        case Token::MULT_GN:    return Token::MULT;
+        case Token::DIV_GN:     return Token::DIV;
+        case Token::MOD_GN:     return Token::MOD;
+
+        default:
+            throw InternalError("token type is not a compound assignment operator");
+    }
+}
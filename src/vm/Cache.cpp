@@ -0,0 +1,402 @@
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+#include <utility>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include "Cache.hpp"
+#include "Function.hpp"
+
+#ifndef INTERPRETER_VERSION
+#define INTERPRETER_VERSION ("unknown")
+#endif
+
+// Bumped whenever the layout of entries or the instruction set changes
+#define CACHE_FORMAT_VERSION (5)
+#define CACHE_MAGIC (0x31435548) // "HUC1"
+#define CACHE_EXTENSION (".huc")
+
+namespace
+{
+    // Thrown on a malformed entry, which is then ignored
+    struct CorruptedEntry {};
+
+    class Writer
+    {
+        public:
+            template<typename T>
+            void write(T value)
+            {
+                this->_buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+            }
+
+            void write(std::string_view string)
+            {
+                this->write(uint32_t(string.size()));
+                this->_buffer.append(string);
+            }
+
+            void write(const runtime::Layout &layout)
+            {
+                this->write(uint32_t(layout.size()));
+                for (const auto &identifier: layout)
+                    this->write(std::string_view(identifier));
+            }
+
+            void write(const vm::Chunk &chunk)
+            {
+                this->write(uint32_t(chunk.getCode().size()));
+                for (const auto &instruction: chunk.getCode()) {
+                    this->write(uint8_t(instruction.opcode));
+                    this->write(instruction.arg);
+                    this->write(instruction.operand);
+                }
+
+                this->write(uint32_t(chunk.getConstants().size()));
+                for (const auto &constant: chunk.getConstants()) {
+                    this->write(uint8_t(constant.getType()));
+
+                    if (constant.getType() == Token::INT_TYPE)
+                        this->write(constant.getInteger());
+                    else
+                        this->write(std::string_view(constant.get<Token::String>()));
+                }
+
+                this->write(uint32_t(chunk.getVariables().size()));
+                for (const auto &variable: chunk.getVariables()) {
+                    this->write(std::string_view(variable.identifier));
+                    this->write(uint64_t(variable.address.depth));
+                    this->write(uint64_t(variable.address.slot));
+                    this->write(uint8_t(variable.address.dynamic));
+                }
+
+                this->write(uint32_t(chunk.getLayouts().size()));
+                for (const auto &layout: chunk.getLayouts())
+                    this->write(layout);
+
+                this->write(uint32_t(chunk.getFunctions().size()));
+                for (const auto &function: chunk.getFunctions()) {
+                    this->write(std::string_view(function->getIdentifier()));
+
+                    this->write(uint32_t(function->getParams().size()));
+                    for (const auto &param: function->getParams()) {
+                        this->write(std::string_view(param.name));
+                        this->write(uint8_t(param.type));
+                    }
+
+                    this->write(uint8_t(function->getReturnType()));
+                    this->write(uint64_t(function->getSlot()));
+                    this->write(function->getFrame());
+
+                    this->write(uint32_t(function->getLocals().size()));
+                    for (auto local: function->getLocals())
+                        this->write(uint64_t(local));
+
+                    this->write(function->getChunk());
+                }
+            }
+
+            [[nodiscard]] const std::string &getBuffer() const noexcept
+            {
+                return this->_buffer;
+            }
+
+        private:
+            std::string _buffer;
+    };
+
+    class Reader
+    {
+        public:
+            explicit Reader(std::string_view buffer) : _buffer(buffer) {}
+
+            template<typename T>
+            T read()
+            {
+                T value;
+
+                std::memcpy(&value, this->take(sizeof(T)).data(), sizeof(T));
+                return value;
+            }
+
+            std::string readString()
+            {
+                auto size = this->read<uint32_t>();
+
+                return std::string(this->take(size));
+            }
+
+            runtime::Layout readLayout()
+            {
+                runtime::Layout layout(this->read<uint32_t>());
+
+                for (auto &identifier: layout)
+                    identifier = this->readString();
+
+                return layout;
+            }
+
+            vm::Chunk readChunk()
+            {
+                vm::Chunk chunk;
+                std::vector<vm::Chunk::Instruction> code(this->read<uint32_t>());
+
+                for (auto &instruction: code) {
+                    instruction.opcode = vm::Chunk::OpCode(this->read<uint8_t>());
+                    instruction.arg = this->read<uint8_t>();
+                    instruction.operand = this->read<uint32_t>();
+
+                    if (instruction.opcode > vm::Chunk::PRINT)
+                        throw CorruptedEntry();
+                }
+
+                for (auto i = this->read<uint32_t>(); i > 0; i--) {
+                    if (Token::Type(this->read<uint8_t>()) == Token::INT_TYPE)
+                        chunk.addConstant(runtime::Object(this->read<Token::Integer>()));
+                    else
+                        chunk.addConstant(runtime::Object(this->readString()));
+                }
+
+                for (auto i = this->read<uint32_t>(); i > 0; i--) {
+                    auto identifier = this->readString();
+                    runtime::Address address;
+
+                    address.depth = this->read<uint64_t>();
+                    address.slot = this->read<uint64_t>();
+                    address.dynamic = this->read<uint8_t>();
+                    chunk.addVariable(identifier, address);
+                }
+
+                for (auto i = this->read<uint32_t>(); i > 0; i--)
+                    chunk.addLayout(this->readLayout());
+
+                for (auto i = this->read<uint32_t>(); i > 0; i--) {
+                    auto identifier = this->readString();
+                    std::vector<ast::FunctionNode::Param> params(this->read<uint32_t>());
+
+                    for (auto &param: params) {
+                        param.name = this->readString();
+                        param.type = Token::Type(this->read<uint8_t>());
+                    }
+
+                    auto returnType = Token::Type(this->read<uint8_t>());
+                    auto slot = this->read<uint64_t>();
+                    auto frame = this->readLayout();
+                    std::vector<std::size_t> locals(this->read<uint32_t>());
+
+                    for (auto &local: locals)
+                        local = this->read<uint64_t>();
+
+                    chunk.addFunction(std::make_shared<const vm::Function>(
+                        std::move(identifier),
+                        std::move(params),
+                        returnType,
+                        slot,
+                        std::move(frame),
+                        std::move(locals),
+                        this->readChunk()
+                    ));
+                }
+
+                for (const auto &instruction: code) {
+                    chunk.emit(instruction.opcode, instruction.operand, instruction.arg);
+
+                    if (!isValid(instruction, chunk, code.size()))
+                        throw CorruptedEntry();
+                }
+
+                return chunk;
+            }
+
+            [[nodiscard]] bool atEnd() const noexcept
+            {
+                return this->_buffer.empty();
+            }
+
+        private:
+            std::string_view _buffer;
+
+            std::string_view take(std::size_t size)
+            {
+                if (size > this->_buffer.size())
+                    throw CorruptedEntry();
+
+                auto data = this->_buffer.substr(0, size);
+
+                this->_buffer.remove_prefix(size);
+                return data;
+            }
+
+            // Operands indexing the chunk tables or its code must be in range, as the virtual machine trusts them
+            static bool isValid(const vm::Chunk::Instruction &instruction, const vm::Chunk &chunk, std::size_t size)
+            {
+                switch (instruction.opcode) {
+                    case vm::Chunk::CONSTANT:
+                        return instruction.operand < chunk.getConstants().size();
+
+                    case vm::Chunk::LOAD:
+                    case vm::Chunk::DECLARE:
+                    case vm::Chunk::DECLARE_ASSIGN:
+                    case vm::Chunk::ASSIGN:
+                    case vm::Chunk::INCREMENT:
+                        return instruction.operand < chunk.getVariables().size();
+
+                    case vm::Chunk::FUNCTION:
+                        return instruction.operand < chunk.getFunctions().size();
+
+                    case vm::Chunk::ENTER_SCOPE:
+                        return instruction.operand < chunk.getLayouts().size();
+
+                    case vm::Chunk::JUMP:
+                    case vm::Chunk::JUMP_IF_FALSE:
+                    case vm::Chunk::AND:
+                    case vm::Chunk::OR:
+                        return instruction.operand < size;
+
+                    default:
+                        return true;
+                }
+            }
+    };
+
+    void writeHeader(Writer &writer, std::string_view source)
+    {
+        writer.write(uint32_t(CACHE_MAGIC));
+        writer.write(uint32_t(CACHE_FORMAT_VERSION));
+        writer.write(std::string_view(INTERPRETER_VERSION));
+        writer.write(vm::Cache::hash(source));
+        writer.write(uint64_t(source.size()));
+    }
+
+    bool readHeader(Reader &reader, std::string_view source)
+    {
+        return
+            reader.read<uint32_t>() == CACHE_MAGIC &&
+            reader.read<uint32_t>() == CACHE_FORMAT_VERSION &&
+            reader.readString() == INTERPRETER_VERSION &&
+            reader.read<uint64_t>() == vm::Cache::hash(source) &&
+            reader.read<uint64_t>() == source.size();
+    }
+};
+
+vm::Cache::Cache(std::filesystem::path path)
+:   _path(std::move(path))
+{
+}
+
+vm::Cache vm::Cache::locate(const std::string &sourcePath, std::string_view source)
+{
+    const auto *directory = std::getenv(CACHE_DIR_VARIABLE);
+
+    if (directory && *directory)
+        return Cache(std::filesystem::path(directory) / fmt::format("{:016x}{}", hash(source), CACHE_EXTENSION));
+
+    return Cache(std::filesystem::path(sourcePath).replace_extension(CACHE_EXTENSION));
+}
+
+std::optional<vm::Chunk> vm::Cache::load(std::string_view source, runtime::State &globalState) const
+{
+    // Global slots stored in the entry are only valid if the identifiers are resolved in the same order
+    if (!globalState.getSymbols().empty())
+        return std::nullopt;
+
+    std::ifstream file(this->_path, std::ios::binary);
+
+    if (!file)
+        return std::nullopt;
+
+    std::ostringstream content;
+
+    content << file.rdbuf();
+
+    auto buffer = content.str();
+    Reader reader(buffer);
+
+    try {
+        if (!readHeader(reader, source))
+            return std::nullopt;
+
+        std::vector<std::pair<std::string, uint8_t>> globals(reader.read<uint32_t>());
+
+        for (auto &[identifier, usage]: globals) {
+            identifier = reader.readString();
+            usage = reader.read<uint8_t>();
+        }
+
+        auto chunk = reader.readChunk();
+
+        if (!reader.atEnd())
+            return std::nullopt;
+
+        for (const auto &[identifier, usage]: globals)
+            globalState.use(globalState.resolve(identifier), usage);
+
+        return chunk;
+    } catch (const CorruptedEntry &) {
+        return std::nullopt;
+    }
+}
+
+void vm::Cache::store(std::string_view source, const vm::Chunk &chunk, const runtime::State &globalState) const noexcept
+{
+    try {
+        Writer writer;
+        std::vector<std::string_view> globals(globalState.getSymbols().size());
+
+        for (const auto &[identifier, slot]: globalState.getSymbols())
+            globals[slot] = identifier;
+
+        writeHeader(writer, source);
+        writer.write(uint32_t(globals.size()));
+        for (std::size_t slot = 0; slot < globals.size(); slot++) {
+            writer.write(globals[slot]);
+            writer.write(globalState.getUsage(slot));
+        }
+        writer.write(chunk);
+
+        // Written aside then renamed, so concurrent interpreters never read a partial entry
+        auto temporary = this->_path;
+        temporary += fmt::format(".{}", getpid());
+
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+            file.write(writer.getBuffer().data(), std::streamsize(writer.getBuffer().size()));
+
+            if (!file.flush()) {
+                std::error_code error;
+                std::filesystem::remove(temporary, error);
+                return;
+            }
+        }
+
+        std::error_code error;
+
+        std::filesystem::rename(temporary, this->_path, error);
+        if (error)
+            std::filesystem::remove(temporary, error);
+    } catch (...) {
+    }
+}
+
+const std::filesystem::path &vm::Cache::getPath() const noexcept
+{
+    return this->_path;
+}
+
+// 64 bits FNV-1a
+uint64_t vm::Cache::hash(std::string_view source) noexcept
+{
+    uint64_t hash = 0xcbf29ce484222325;
+
+    for (auto c: source) {
+        hash ^= uint8_t(c);
+        hash *= 0x100000001b3;
+    }
+
+    return hash;
+}
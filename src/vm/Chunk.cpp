@@ -0,0 +1,81 @@
+#include <utility>
+
+#include "Chunk.hpp"
+#include "Function.hpp"
+
+std::size_t vm::Chunk::emit(vm::Chunk::OpCode opcode, uint32_t operand, uint8_t arg)
+{
+    this->_code.push_back(Instruction{
+        .opcode = opcode,
+        .arg = arg,
+        .operand = operand
+    });
+
+    return this->_code.size() - 1;
+}
+
+void vm::Chunk::patch(std::size_t index, uint32_t operand)
+{
+    if (index >= this->_code.size())
+        throw InternalError("Chunk: patched instruction out of range");
+
+    this->_code[index].operand = operand;
+}
+
+std::size_t vm::Chunk::size() const noexcept
+{
+    return this->_code.size();
+}
+
+uint32_t vm::Chunk::addConstant(const runtime::Object &object)
+{
+    this->_constants.push_back(object);
+
+    return this->_constants.size() - 1;
+}
+
+uint32_t vm::Chunk::addVariable(const std::string &identifier, const runtime::Address &address)
+{
+    this->_variables.push_back(Variable{.identifier = identifier, .address = address});
+
+    return this->_variables.size() - 1;
+}
+
+uint32_t vm::Chunk::addFunction(const vm::Function::ptr &function)
+{
+    this->_functions.push_back(function);
+
+    return this->_functions.size() - 1;
+}
+
+uint32_t vm::Chunk::addLayout(runtime::Layout layout)
+{
+    this->_layouts.push_back(std::move(layout));
+
+    return this->_layouts.size() - 1;
+}
+
+const std::vector<vm::Chunk::Instruction> &vm::Chunk::getCode() const noexcept
+{
+    return this->_code;
+}
+
+const std::vector<runtime::Object> &vm::Chunk::getConstants() const noexcept
+{
+    return this->_constants;
+}
+
+const std::vector<vm::Chunk::Variable> &vm::Chunk::getVariables() const noexcept
+{
+    return this->_variables;
+}
+
+const std::vector<vm::Function::ptr> &vm::Chunk::getFunctions() const noexcept
+{
+    return this->_functions;
+}
+
+const std::vector<runtime::Layout> &vm::Chunk::getLayouts() const noexcept
+{
+    return this->_layouts;
+}
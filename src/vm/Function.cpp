@@ -0,0 +1,72 @@
+#include <utility>
+
+#include "Function.hpp"
+
+vm::Function::ptr vm::Function::create(
+    const ast::FunctionNode &node,
+    vm::Chunk chunk
+)
+{
+    return std::make_shared<const Function>(
+        node.getIdentifier(),
+        node.getParams(),
+        node.getReturnType(),
+        node.getSlot(),
+        node.getFrame(),
+        node.getLocals(),
+        std::move(chunk)
+    );
+}
+
+vm::Function::Function(
+    std::string identifier,
+    std::vector<ast::FunctionNode::Param> params,
+    Token::Type returnType,
+    std::size_t slot,
+    runtime::Layout frame,
+    std::vector<std::size_t> locals,
+    vm::Chunk chunk
+):  _identifier(std::move(identifier)),
+    _params(std::move(params)),
+    _returnType(returnType),
+    _slot(slot),
+    _frame(std::move(frame)),
+    _locals(std::move(locals)),
+    _chunk(std::move(chunk))
+{
+}
+
+const std::string &vm::Function::getIdentifier() const noexcept
+{
+    return this->_identifier;
+}
+
+const std::vector<ast::FunctionNode::Param> &vm::Function::getParams() const noexcept
+{
+    return this->_params;
+}
+
+Token::Type vm::Function::getReturnType() const noexcept
+{
+    return this->_returnType;
+}
+
+std::size_t vm::Function::getSlot() const noexcept
+{
+    return this->_slot;
+}
+
+const runtime::Layout &vm::Function::getFrame() const noexcept
+{
+    return this->_frame;
+}
+
+const std::vector<std::size_t> &vm::Function::getLocals() const noexcept
+{
+    return this->_locals;
+}
+
+const vm::Chunk &vm::Function::getChunk() const noexcept
+{
+    return this->_chunk;
+}
@@ -0,0 +1,485 @@
+#include <utility>
+
+#include "VirtualMachine.hpp"
+#include "EvalVisitor.hpp"
+#include "Builtin.hpp"
+#include "Return.hpp"
+#include "Break.hpp"
+#include "Continue.hpp"
+
+// Operands known to be integers by ast::TypeVisitor skip the type checks of the object operators
+#define BINARY_OPERATION(opcode, op)                                        \
+    case opcode: {                                                          \
+        const auto right = this->pop();                                     \
+        auto &left = this->top();                                           \
+        if (instruction.arg == Chunk::OPERANDS_INTEGER)                     \
+            left = Token::Integer(left.getInteger() op right.getInteger()); \
+        else                                                                \
+            left = left op right;                                           \
+        break;                                                              \
+    }
+
+// Integer division and modulo, which fail on zero
+#define DIVISION_OPERATION(opcode, op, function)                            \
+    case opcode: {                                                          \
+        const auto right = this->pop();                                     \
+        auto &left = this->top();                                           \
+        if (instruction.arg == Chunk::OPERANDS_INTEGER)                     \
+            left = function(left.getInteger(), right.getInteger());         \
+        else                                                                \
+            left = left op right;                                           \
+        break;                                                              \
+    }
+
+#define UNARY_OPERATION(opcode, op)                                         \
+    case opcode: {                                                          \
+        auto &operand = this->top();                                        \
+        if (instruction.arg == Chunk::OPERANDS_INTEGER)                     \
+            operand = Token::Integer(op operand.getInteger());              \
+        else                                                                \
+            operand = op operand;                                           \
+        break;                                                              \
+    }
+
+vm::VirtualMachine::VirtualMachine(runtime::Output::ptr output, runtime::State::ptr globalState)
+:   _output(std::move(output)),
+    _stack(),
+    _frames(),
+    _result(),
+    _globalState(std::move(globalState)),
+    _localState(this->_globalState),
+    _maxCallDepth(ast::EvalVisitor::DEFAULT_MAX_CALL_DEPTH)
+{}
+
+void vm::VirtualMachine::run(const vm::Chunk &chunk)
+{
+    auto state = this->_localState;
+
+    this->_frames.push_back(Frame{
+        .function = nullptr,
+        .chunk = &chunk,
+        .ip = 0,
+        .callerState = nullptr
+    });
+
+    try {
+        this->execute();
+    } catch (...) {
+        this->_stack.clear();
+        this->_frames.clear();
+        this->_localState = std::move(state);
+        throw;
+    }
+}
+
+void vm::VirtualMachine::execute()
+{
+    auto *frame = &this->_frames.back();
+    auto *code = frame->chunk->getCode().data();
+    auto ip = frame->ip;
+
+    for (;;) {
+        const auto &instruction = code[ip++];
+
+        switch (instruction.opcode) {
+            case Chunk::INTEGER:
+                this->_stack.emplace_back(static_cast<Token::Integer>(instruction.operand));
+                break;
+
+            case Chunk::CONSTANT:
+                this->_stack.push_back(frame->chunk->getConstants()[instruction.operand]);
+                break;
+
+            case Chunk::LOAD: {
+                const auto &variable = frame->chunk->getVariables()[instruction.operand];
+
+                this->_stack.push_back(this->_localState->load(variable.address, variable.identifier));
+                break;
+            }
+
+            // Like ast::EvalVisitor, the last value consumed by a statement is kept as the result
+            case Chunk::POP:
+                this->_result = this->pop();
+                break;
+
+            case Chunk::DECLARE: {
+                const auto &variable = frame->chunk->getVariables()[instruction.operand];
+
+                this->_localState->set(
+                    variable.address.slot,
+                    variable.identifier,
+                    runtime::Object(Token::Type(instruction.arg))
+                );
+                break;
+            }
+
+            case Chunk::DECLARE_ASSIGN: {
+                const auto &variable = frame->chunk->getVariables()[instruction.operand];
+                runtime::Object object((Token::Type(instruction.arg)));
+
+                this->_result = this->pop();
+                object.assign(this->_result);
+                this->_localState->set(variable.address.slot, variable.identifier, object);
+                break;
+            }
+
+            case Chunk::ASSIGN: {
+                const auto &variable = frame->chunk->getVariables()[instruction.operand];
+                auto &object = this->_localState->find(variable.address, variable.identifier);
+                const auto &value = this->_result = this->pop();
+
+                switch (instruction.arg) {
+                    case Token::ASSIGN:     object.assign(value); break;
+                    case Token::PLUS_GN:    object.assign(object + value); break;
+                    case Token::MINUS_GN:   object.assign(object - value); break;
+                    case Token::MULT_GN:    object.assign(object * value); break;
+                    case Token::DIV_GN:     object.assign(object / value); break;
+                    case Token::MOD_GN:     object.assign(object % value); break;
+
+                    default:
+                        throw InternalError("VirtualMachine : invalid operator in ASSIGN");
+                }
+                break;
+            }
+
+            case Chunk::INCREMENT: {
+                const auto &variable = frame->chunk->getVariables()[instruction.operand];
+                auto &object = this->_localState->find(variable.address, variable.identifier);
+
+                switch (instruction.arg) {
+                    case Token::INCR: object.assign(object + 1); break;
+                    case Token::DECR: object.assign(object - 1); break;
+
+                    default:
+                        throw InternalError("VirtualMachine : invalid operator in INCREMENT");
+                }
+                break;
+            }
+
+            case Chunk::FUNCTION: {
+                const auto &function = frame->chunk->getFunctions()[instruction.operand];
+
+                this->_localState->set(
+                    function->getSlot(),
+                    function->getIdentifier(),
+                    runtime::Object(function)
+                );
+                break;
+            }
+
+            case Chunk::ENTER_SCOPE:
+                this->_localState = runtime::State::create(
+                    this->_localState,
+                    frame->chunk->getLayouts()[instruction.operand]
+                );
+                break;
+
+            case Chunk::EXIT_SCOPE:
+                for (uint32_t i = 0; i < instruction.operand; i++)
+                    this->_localState = this->_localState->restoreParent();
+                break;
+
+            DIVISION_OPERATION(Chunk::MOD, %, runtime::Object::modulo)
+            DIVISION_OPERATION(Chunk::DIV, /, runtime::Object::divide)
+            BINARY_OPERATION(Chunk::MULT, *)
+            BINARY_OPERATION(Chunk::ADD, +)
+            BINARY_OPERATION(Chunk::SUB, -)
+            BINARY_OPERATION(Chunk::GT, >)
+            BINARY_OPERATION(Chunk::GTE, >=)
+            BINARY_OPERATION(Chunk::LT, <)
+            BINARY_OPERATION(Chunk::LTE, <=)
+            BINARY_OPERATION(Chunk::EQUAL, ==)
+            BINARY_OPERATION(Chunk::NOT_EQUAL, !=)
+            BINARY_OPERATION(Chunk::BITWISE_AND, &)
+            BINARY_OPERATION(Chunk::BITWISE_OR, |)
+            BINARY_OPERATION(Chunk::BITWISE_XOR, ^)
+            BINARY_OPERATION(Chunk::BITWISE_LSHIFT, <<)
+            BINARY_OPERATION(Chunk::BITWISE_RSHIFT, >>)
+
+            UNARY_OPERATION(Chunk::POSITIVE, +)
+            UNARY_OPERATION(Chunk::NEGATIVE, -)
+            UNARY_OPERATION(Chunk::NOT, !)
+            UNARY_OPERATION(Chunk::BITWISE_NOT, ~)
+
+            case Chunk::AND:
+                if (!static_cast<bool>(this->pop())) {
+                    this->_stack.emplace_back(Token::Integer(false));
+                    ip = instruction.operand;
+                }
+                break;
+
+            case Chunk::OR:
+                if (static_cast<bool>(this->pop())) {
+                    this->_stack.emplace_back(Token::Integer(true));
+                    ip = instruction.operand;
+                }
+                break;
+
+            case Chunk::BOOL: {
+                auto &operand = this->top();
+                operand = runtime::Object(Token::Integer(static_cast<bool>(operand)));
+                break;
+            }
+
+            case Chunk::JUMP:
+                ip = instruction.operand;
+                break;
+
+            case Chunk::JUMP_IF_FALSE:
+                if (!static_cast<bool>(this->pop()))
+                    ip = instruction.operand;
+                break;
+
+            // Made in place when calling the function being executed, the current frame restarts
+            case Chunk::TAIL_CALL:
+                if (this->tailCall(instruction.operand, Chunk::CallKind(instruction.arg))) {
+                    ip = 0;
+                    break;
+                }
+
+                [[fallthrough]];
+
+            case Chunk::CALL:
+                frame->ip = ip;
+
+                // Builtins run natively, without a frame
+                if (!this->call(instruction.operand, Chunk::CallKind(instruction.arg)))
+                    break;
+
+                frame = &this->_frames.back();
+                code = frame->chunk->getCode().data();
+                ip = 0;
+                break;
+
+            case Chunk::RETURN:
+                if (!this->ret(Chunk::ReturnKind(instruction.arg)))
+                    return;
+
+                frame = &this->_frames.back();
+                code = frame->chunk->getCode().data();
+                ip = frame->ip;
+                break;
+
+            case Chunk::INVALID_JUMP:
+                switch (instruction.arg) {
+                    case Chunk::JUMP_BREAK:     throw runtime::Break();
+                    case Chunk::JUMP_CONTINUE:  throw runtime::Continue();
+                    default:                    throw runtime::Return(std::nullopt);
+                }
+
+            case Chunk::PRINT:
+                if (instruction.arg)
+                    this->_output->write(this->pop());
+
+                this->_output->endLine();
+                break;
+
+            default:
+                throw InternalError("VirtualMachine: unknown opcode");
+        }
+    }
+}
+
+bool vm::VirtualMachine::call(uint32_t argc, vm::Chunk::CallKind kind)
+{
+    const auto calleeIndex = this->_stack.size() - argc - 1;
+    const auto &callee = this->_stack[calleeIndex];
+
+    if (callee.getType() != Token::FNC_TYPE)
+        throw LogicalError("object is not callable");
+
+    // The result replaces the callee and its arguments on the stack
+    if (const auto *builtin = callee.getIf<runtime::Builtin>()) {
+        auto result = builtin->call(std::span<const runtime::Object>(this->_stack.data() + calleeIndex + 1, argc));
+
+        if (result.isNull() && usesValue(this->_frames.back()))
+            throw ast::EvalVisitor::noReturnValue(builtin->getIdentifier());
+
+        this->_stack.erase(this->_stack.begin() + long(calleeIndex), this->_stack.end());
+        this->_stack.push_back(std::move(result));
+
+        return false;
+    }
+
+    auto function = callee.getShared<Function>();
+
+    // Same scoping rules as ast::EvalVisitor : function's state takes the current state as parent state.
+    auto state = this->bindArguments(*function, this->_localState, argc, kind);
+
+    // The first frame runs the chunk, it is not a call
+    if (this->_frames.size() > this->_maxCallDepth) {
+        std::vector<std::string_view> chain;
+
+        for (std::size_t i = 1; i < this->_frames.size(); i++)
+            chain.emplace_back(this->_frames[i].function->getIdentifier());
+
+        chain.emplace_back(function->getIdentifier());
+
+        throw ast::EvalVisitor::callDepthExceeded(this->_maxCallDepth, chain);
+    }
+
+    this->_stack.erase(this->_stack.begin() + long(calleeIndex), this->_stack.end());
+
+    const auto *chunk = &function->getChunk();
+
+    this->_frames.push_back(Frame{
+        .function = std::move(function),
+        .chunk = chunk,
+        .ip = 0,
+        .callerState = std::move(this->_localState)
+    });
+
+    this->_localState = std::move(state);
+
+    return true;
+}
+
+bool vm::VirtualMachine::tailCall(uint32_t argc, vm::Chunk::CallKind kind)
+{
+    const auto &frame = this->_frames.back();
+    const auto calleeIndex = this->_stack.size() - argc - 1;
+    const auto &callee = this->_stack[calleeIndex];
+
+    // Same rules as ast::EvalVisitor : only calls to the function being executed reuse its frame, unless a function
+    // may look up the variables they replace.
+    if (callee.getIf<Function>() != frame.function.get() || this->_globalState->isLookedUp(frame.function->getLocals()))
+        return false;
+
+    // The new frame takes the place of the current one, below the state of the caller
+    auto state = this->bindArguments(*frame.function, frame.callerState, argc, kind);
+
+    this->_stack.erase(this->_stack.begin() + long(calleeIndex), this->_stack.end());
+    this->_localState = std::move(state);
+
+    return true;
+}
+
+runtime::State::ptr vm::VirtualMachine::bindArguments(
+    const vm::Function &function,
+    const runtime::State::ptr &parent,
+    uint32_t argc,
+    vm::Chunk::CallKind kind
+)
+{
+    const auto &namedParams = function.getParams();
+
+    if (argc != namedParams.size())
+        throw LogicalError("number of arguments mismatch");
+
+    auto state = runtime::State::create(parent, function.getFrame());
+    const auto *args = &this->_stack[this->_stack.size() - argc];
+
+    for (std::size_t i = 0; i < argc; i++) {
+        const auto &arg = args[i];
+        const auto &namedParam = namedParams[i];
+
+        if (kind == Chunk::CALL_CHECKED && arg.getType() != namedParam.type)
+            throw ast::EvalVisitor::invalidArgType(namedParam.name, arg.getType(), namedParam.type);
+
+        state->set(i, namedParam.name, arg);
+    }
+
+    return state;
+}
+
+bool vm::VirtualMachine::ret(vm::Chunk::ReturnKind kind)
+{
+    auto &frame = this->_frames.back();
+
+    // Calls to void functions still leave an object on the stack, as every expression does.
+    runtime::Object result;
+
+    if (frame.function) {
+        auto returnType = frame.function->getReturnType();
+
+        switch (kind) {
+            case Chunk::RETURN_VALUE: {
+                result = this->pop();
+
+                // The value may be that of a call to a function returning no value
+                auto type = result.isNull() ? Token::VOID_TYPE : result.getType();
+
+                if (type != returnType)
+                    throw ast::EvalVisitor::invalidReturnType(type, returnType);
+                break;
+            }
+
+            case Chunk::RETURN_NOTHING:
+                if (returnType != Token::VOID_TYPE)
+                    throw ast::EvalVisitor::invalidReturnType(Token::VOID_TYPE, returnType);
+                break;
+
+            case Chunk::RETURN_IMPLICIT:
+                if (returnType != Token::VOID_TYPE)
+                    throw ast::EvalVisitor::missingReturn(returnType);
+                break;
+        }
+
+        // Only the first frame has no function, so the frame of the caller comes before
+        if (result.isNull() && usesValue(this->_frames[this->_frames.size() - 2]))
+            throw ast::EvalVisitor::noReturnValue(frame.function->getIdentifier());
+
+        this->_localState = std::move(frame.callerState);
+    }
+
+    this->_frames.pop_back();
+
+    if (this->_frames.empty())
+        return false;
+
+    this->_stack.push_back(std::move(result));
+
+    return true;
+}
+
+bool vm::VirtualMachine::usesValue(const vm::VirtualMachine::Frame &caller) noexcept
+{
+    // CompileVisitor follows calls whose value is discarded by a POP, and those whose value is returned by a RETURN
+    auto opcode = caller.chunk->getCode()[caller.ip].opcode;
+
+    return opcode != Chunk::POP && opcode != Chunk::RETURN;
+}
+
+runtime::Object vm::VirtualMachine::pop()
+{
+    auto object = std::move(this->_stack.back());
+
+    this->_stack.pop_back();
+
+    return object;
+}
+
+runtime::Object &vm::VirtualMachine::top()
+{
+    return this->_stack.back();
+}
+
+const runtime::Object &vm::VirtualMachine::value() const noexcept
+{
+    return this->_result;
+}
+
+Token::Integer vm::VirtualMachine::getResult() const
+{
+    return this->_result.getInteger();
+}
+
+const runtime::State &vm::VirtualMachine::getState() const noexcept
+{
+    return *this->_localState;
+}
+
+void vm::VirtualMachine::clearState() noexcept
+{
+    this->_localState->clear();
+}
+
+void vm::VirtualMachine::setMaxCallDepth(std::size_t depth) noexcept
+{
+    this->_maxCallDepth = depth;
+}
+
+std::size_t vm::VirtualMachine::getMaxCallDepth() const noexcept
+{
+    return this->_maxCallDepth;
+}
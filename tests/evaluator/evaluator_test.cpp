@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
+#include <limits>
 #include <sstream>
 
 #include "Evaluator.hpp"
+#include "ResolveVisitor.hpp"
+#include "TypeVisitor.hpp"
+#include "FoldVisitor.hpp"
 
 struct EvaluatorTest
 {
@@ -10,18 +14,25 @@ struct EvaluatorTest
     Token::Integer expectedResult;
 };
 
+static const std::vector<Evaluator::Mode> evaluatorModes{
+    Evaluator::Mode::TREE_WALKING,
+    Evaluator::Mode::BYTECODE
+};
+
 static void testEvaluator(const std::vector<EvaluatorTest> &testCases)
 {
-    Evaluator evaluator;
+    for (auto mode : evaluatorModes) {
+        Evaluator evaluator(std::cout, mode);
 
-    for (const auto &test : testCases) {
-        std::cout << test.description << std::endl;
+        for (const auto &test : testCases) {
+            std::cout << test.description << std::endl;
 
-        evaluator.feed(test.expression + ";");
+            evaluator.feed(test.expression + ";");
 
-        EXPECT_EQ(evaluator.getResult(), test.expectedResult);
+            EXPECT_EQ(evaluator.getResult(), test.expectedResult);
 
-        evaluator.clear();
+            evaluator.clear();
+        }
     }
 }
 
@@ -598,22 +609,24 @@ TEST(EvaluatorTest, DeclarationAndAssignment)
         }
     };
 
-    for (const auto &test : testCases) {
-        std::cout << test.description << std::endl;
-        Evaluator evaluator;
+    for (auto mode : evaluatorModes) {
+        for (const auto &test : testCases) {
+            std::cout << test.description << std::endl;
+            Evaluator evaluator(std::cout, mode);
 
-        evaluator.feed(test.expression);
+            evaluator.feed(test.expression);
 
-        auto &state = evaluator.getState();
+            auto &state = evaluator.getState();
 
-        for (const auto &[identifier, expected] : test.expected) {
-            const auto &obj = state.get(identifier);
+            for (const auto &[identifier, expected] : test.expected) {
+                const auto &obj = state.get(identifier);
 
-            EXPECT_TRUE(obj);
-            EXPECT_EQ(*obj, expected);
+                EXPECT_TRUE(obj);
+                EXPECT_EQ(*obj, expected);
 
-            if (test.result) {
-                EXPECT_EQ(evaluator.getResult(), *test.result);
+                if (test.result) {
+                    EXPECT_EQ(evaluator.getResult(), *test.result);
+                }
             }
         }
     }
@@ -671,19 +684,21 @@ TEST(EvaluatorTest, String)
         }
     };
 
-    for (const auto &test : testCases) {
-        std::cout << test.description << std::endl;
-        Evaluator evaluator;
+    for (auto mode : evaluatorModes) {
+        for (const auto &test : testCases) {
+            std::cout << test.description << std::endl;
+            Evaluator evaluator(std::cout, mode);
 
-        evaluator.feed(test.expression);
+            evaluator.feed(test.expression);
 
-        const auto &state = evaluator.getState();
+            const auto &state = evaluator.getState();
 
-        for (const auto &[identifier, expected] : test.expected) {
-            const auto &obj = state.get(identifier);
+            for (const auto &[identifier, expected] : test.expected) {
+                const auto &obj = state.get(identifier);
 
-            EXPECT_EQ(obj->getType(), Token::STR_TYPE);
-            EXPECT_EQ(obj->get<Token::String>(), expected.get<Token::String>());
+                EXPECT_EQ(obj->getType(), Token::STR_TYPE);
+                EXPECT_EQ(obj->get<Token::String>(), expected.get<Token::String>());
+            }
         }
     }
 }
@@ -726,27 +741,328 @@ TEST(EvaluatorTest, Print)
             .description = "6. Print chained",
             .expression = "print(1); print(\"yo\");",
             .expectedStdout = "1\nyo\n"
+        },
+        PrintTest{
+            .description = "7. Print negative integer",
+            .expression = "print(-2147483647 - 1);",
+            .expectedStdout = "-2147483648\n"
         }
     };
 
-    Evaluator evaluator;
+    for (auto mode : evaluatorModes) {
+        Evaluator evaluator(std::cout, mode);
+
+        for (const auto &tc : testCases) {
+            std::cout << tc.description << std::endl;
+            testing::internal::CaptureStdout();
+
+            try {
+                evaluator.feed(tc.expression);
+            } catch (const std::exception &err) {
+                auto _ = testing::internal::GetCapturedStdout();
+                std::cerr << err.what() << std::endl;
+                EXPECT_TRUE(false);
+                continue;
+            }
+
+            const auto &actualStdout = testing::internal::GetCapturedStdout();
+
+            EXPECT_STREQ(actualStdout.c_str(), tc.expectedStdout.c_str());
+        }
+    }
+}
+
+TEST(EvaluatorTest, PrintFlush)
+{
+    for (auto mode : evaluatorModes) {
+        std::stringstream output;
+        Evaluator evaluator(output, mode);
+
+        // Output printed before an error is not lost
+        EXPECT_THROW(evaluator.feed("print(1); print(1 / 0);"), LogicalError);
+        EXPECT_EQ(output.str(), "1\n");
+
+        // Nothing of a program which failed is kept for the next one
+        EXPECT_THROW(evaluator.feed("print(1);\n@"), LexicalError);
+        EXPECT_THROW(evaluator.feed("print(1) print(2);"), SyntaxError);
 
-    for (const auto &tc : testCases) {
-        std::cout << tc.description << std::endl;
-        testing::internal::CaptureStdout();
+        output.str("");
 
         try {
-            evaluator.feed(tc.expression);
-        } catch (const std::exception &err) {
-            auto _ = testing::internal::GetCapturedStdout();
-            std::cerr << err.what() << std::endl;
-            EXPECT_TRUE(false);
-            continue;
+            evaluator.feed("print(2); @");
+            FAIL();
+        } catch (const LexicalError &err) {
+            EXPECT_EQ(err.getLine(), 0);
+            EXPECT_EQ(err.getColumn(), 10);
         }
 
-        const auto &actualStdout = testing::internal::GetCapturedStdout();
+        EXPECT_EQ(output.str(), "");
+
+        // Strings larger than the output buffer
+        std::string large(100000, 'a');
 
-        EXPECT_STREQ(actualStdout.c_str(), tc.expectedStdout.c_str());
+        output.str("");
+        evaluator.feed("for (int i = 0; i < 2; i++) print(\"" + large + "\");");
+        EXPECT_EQ(output.str(), large + "\n" + large + "\n");
+    }
+}
+
+TEST(EvaluatorTest, ConstantFolding)
+{
+    Parser parser;
+    auto globalState = runtime::State::create();
+    ast::ResolveVisitor resolver(*globalState);
+    ast::TypeVisitor checker;
+    ast::FoldVisitor folder;
+
+    parser.feed(
+        "print(2 * 60 * 60);"
+        "print(\"pre\" + \"fix\");"
+        "print((a - b) * 1);"
+        "print(s + 0);"
+        "if (1 < 0) print(1);"
+        "while (0 && a) print(2);"
+        "print(1 / 0);"
+    );
+
+    auto root = parser.getAstRoot();
+
+    root->accept(resolver);
+    root->accept(checker);
+    root->accept(folder);
+
+    const auto &statements = std::dynamic_pointer_cast<ast::ProgramNode>(root)->getStatements();
+    auto printed = [&](std::size_t i) {
+        return std::dynamic_pointer_cast<ast::PrintNode>(statements[i])->getExpression();
+    };
+
+    // Pruned branches are removed
+    ASSERT_EQ(statements.size(), 5);
+    EXPECT_EQ(std::dynamic_pointer_cast<ast::IntegerNode>(printed(0))->getValue(), 7200);
+    EXPECT_EQ(std::dynamic_pointer_cast<ast::StringNode>(printed(1))->getValue(), "prefix");
+    EXPECT_EQ(std::dynamic_pointer_cast<ast::BinaryNode>(printed(2))->getOperator(), Token::MINUS);
+    // The type of an identifier is unknown, so is the error adding 0 may raise
+    EXPECT_EQ(std::dynamic_pointer_cast<ast::BinaryNode>(printed(3))->getOperator(), Token::PLUS);
+    // Errors are raised at runtime
+    EXPECT_EQ(std::dynamic_pointer_cast<ast::BinaryNode>(printed(4))->getOperator(), Token::DIV);
+
+    for (auto mode : evaluatorModes) {
+        std::stringstream output;
+        Evaluator evaluator(output, mode);
+
+        evaluator.feed("if (2 > 1) print(\"a\" + \"b\"); else print(0);");
+        EXPECT_EQ(output.str(), "ab\n");
+
+        try {
+            evaluator.feed("print(1); print(2 * 3 / (1 - 1));");
+            FAIL();
+        } catch (const LogicalError &err) {
+            EXPECT_STREQ(err.what(), "Logical error: division by zero.");
+        }
+        EXPECT_EQ(output.str(), "ab\n1\n");
+    }
+}
+
+TEST(EvaluatorTest, TypeChecking)
+{
+    struct TypeCheckingTest{
+        std::string expression;
+        std::string errorMessage;
+    };
+
+    // Type errors are reported before execution, even in code that is never executed
+    const std::vector<TypeCheckingTest> testCases{
+        TypeCheckingTest{
+            "print(1); int a = 2; str s = \"s\"; print(a + s);",
+            "Logical error: type int is not compatible with type str."
+        },
+        TypeCheckingTest{
+            "print(1); if (0) { int a = \"a\"; }",
+            "Logical error: type int is not compatible with type str."
+        },
+        TypeCheckingTest{
+            "print(1); { fnc f(int a) int { return a; } f(\"a\"); }",
+            "Logical error: invalid type in call : a is of type str but expected type int."
+        },
+        TypeCheckingTest{
+            "print(1); fnc f() str { return 1; }",
+            "Logical error: invalid return type in call : returned object is of type int, but expected return type is str."
+        },
+        TypeCheckingTest{
+            "print(1); int a = 0; a(1);",
+            "Logical error: object is not callable."
+        },
+    };
+
+    for (auto mode : evaluatorModes) {
+        for (const auto &testCase : testCases) {
+            std::stringstream output;
+            Evaluator evaluator(output, mode);
+
+            try {
+                evaluator.feed(testCase.expression);
+                FAIL() << testCase.expression;
+            } catch (const LogicalError &err) {
+                EXPECT_STREQ(err.what(), testCase.errorMessage.c_str());
+            }
+            EXPECT_EQ(output.str(), "");
+        }
+
+        // Identifiers unknown before execution are checked when it happens
+        std::stringstream output;
+        Evaluator evaluator(output, mode);
+
+        EXPECT_THROW(evaluator.feed("print(1); print(a + 1);"), LogicalError);
+        EXPECT_EQ(output.str(), "1\n");
+
+        // Functions may be reassigned
+        output.str("");
+        evaluator.feed(
+            "fnc f(int a) int { return a; }"
+            "{ fnc g(str s) int { return 2; } fnc h(int a) int { return 3; } h = g; print(h(\"a\")); }"
+        );
+        evaluator.feed("fnc k(str s) int { return 4; } f = k; print(f(\"a\"));");
+        EXPECT_EQ(output.str(), "2\n4\n");
+
+        // Calls made from the same site to another function check their arguments again
+        output.str("");
+        evaluator.feed(
+            "fnc op(int n) int { return n; } fnc twice(int n) int { return n * 2; } fnc size(str s) int { return 0; }"
+            "fnc apply(int n) int { return op(n); }"
+            "print(apply(3)); op = twice; print(apply(3));"
+        );
+        EXPECT_THROW(evaluator.feed("op = size; print(apply(3));"), LogicalError);
+        EXPECT_EQ(output.str(), "3\n6\n");
+
+        // Identifiers referring to conflicting declarations are typed when executed, even when resolved before the
+        // conflicting declaration
+        const std::vector<TypeCheckingTest> redeclarations{
+            TypeCheckingTest{"print(x * 2);", "Logical error: incompatible type."},
+            TypeCheckingTest{"x += 1;", "Logical error: type str is not compatible with type int."},
+            TypeCheckingTest{"x++;", "Logical error: type str is not compatible with type int."},
+            TypeCheckingTest{"show(x);", "Logical error: invalid type in call : a is of type str but expected type int."},
+        };
+
+        for (const auto &testCase : redeclarations) {
+            Evaluator redeclaring(output, mode);
+
+            try {
+                redeclaring.feed(
+                    "fnc show(int a) { print(a); }"
+                    "int i = 0; fnc step() int { i++; return 1; } if (i == 5) int x = 1;"
+                    "while (step() && i < 3) if (i == 2) " + testCase.expression + " else str x = \"ab\";"
+                );
+                FAIL() << testCase.expression;
+            } catch (const LogicalError &err) {
+                EXPECT_STREQ(err.what(), testCase.errorMessage.c_str());
+            }
+        }
+    }
+}
+
+TEST(EvaluatorTest, CallDepth)
+{
+    for (auto mode : evaluatorModes) {
+        std::stringstream output;
+        Evaluator evaluator(output, mode);
+
+        evaluator.setMaxCallDepth(50);
+        evaluator.feed(
+            "fnc depth(int n) int { if (n == 0) return 0; return 1 + depth(n - 1); }"
+            "fnc start(int n) int { return 1 + depth(n); }"
+        );
+
+        try {
+            evaluator.feed("print(start(48));");
+            evaluator.feed("print(start(49));");
+            FAIL();
+        } catch (const LogicalError &err) {
+            EXPECT_STREQ(err.what(), "Logical error: maximum call depth of 50 exceeded : start -> depth (x50).");
+        }
+
+        // Tail calls don't nest
+        evaluator.feed("fnc count(int n) int { if (n == 0) return 0; return count(n - 1); } print(count(100));");
+        EXPECT_EQ(output.str(), "49\n0\n");
+    }
+}
+
+TEST(EvaluatorTest, NativeStack)
+{
+    for (auto mode : evaluatorModes) {
+        std::stringstream output;
+        Evaluator evaluator(output, mode);
+
+        // Deeper than the default native stack of the thread feeding the program holds
+        evaluator.feed(
+            "fnc depth(int n) int { if (n == 0) return 0; return 1 + depth(n - 1); }"
+            "print(depth(50000));"
+        );
+        EXPECT_EQ(output.str(), "50000\n");
+    }
+
+    // Past the native stack, the tree-walking evaluator fails rather than crashing
+    std::stringstream output;
+    Evaluator evaluator(output);
+
+    evaluator.setMaxCallDepth(std::numeric_limits<std::size_t>::max());
+    evaluator.feed("fnc depth(int n) int { if (n == 0) return 0; return 1 + depth(n - 1); }");
+    EXPECT_THROW(evaluator.feed("print(depth(100000000));"), LogicalError);
+    evaluator.feed("print(depth(10));");
+    EXPECT_EQ(output.str(), "10\n");
+}
+
+TEST(EvaluatorTest, InlineCaches)
+{
+    for (auto mode : evaluatorModes) {
+        std::stringstream output;
+        Evaluator evaluator(output, mode);
+
+        evaluator.feed(
+            "fnc f(int a) int { return a; }"
+            "fnc g(str a) int { return 2; }"
+            "fnc call(int n) int { return f(n); }"
+            "print(call(1));"
+        );
+
+        // The call site of f no longer calls the function it cached
+        try {
+            evaluator.feed("f = g; print(call(3));");
+            FAIL();
+        } catch (const LogicalError &err) {
+            EXPECT_STREQ(err.what(), "Logical error: invalid type in call : a is of type int but expected type str.");
+        }
+
+        evaluator.feed("fnc h(int a) int { return a * 2; } f = h; print(call(3));");
+        EXPECT_EQ(output.str(), "1\n6\n");
+    }
+}
+
+TEST(EvaluatorTest, Specialization)
+{
+    for (auto mode : evaluatorModes) {
+        std::stringstream output;
+        Evaluator evaluator(output, mode);
+
+        // The types of calls to global functions are only known once executed
+        evaluator.feed(
+            "fnc number() int { return 2; }"
+            "fnc word() str { return \"ab\"; }"
+            "fnc get() int { return 1; }"
+            "int total = 0;"
+            "fnc twice() { print(get() + get()); print(get() == get()); total += get(); }"
+            "twice();"
+        );
+
+        // The specialized operations go back to the generic ones
+        try {
+            evaluator.feed("get = word; twice();");
+            FAIL();
+        } catch (const LogicalError &err) {
+            EXPECT_STREQ(err.what(), "Logical error: type int is not compatible with type str.");
+        }
+
+        evaluator.feed("get = number; twice(); print(total);");
+        EXPECT_EQ(output.str(), "2\n1\nabab\n1\n4\n1\n3\n");
     }
 }
 
@@ -858,30 +1174,149 @@ TEST(EvaluatorTest, EvaluatorError)
             .description = "20. Type incompatibility #6",
             .expression = "str s = \"yo\"; int n = 42; n + 42 + s + 84;",
             .errorMessage = "Logical error: type int is not compatible with type str."
+        },
+        EvaluatorErrorTest{
+            .description = "21. Value of a function returning none #1",
+            .expression = "fnc nothing() {} 1 + nothing()",
+            .errorMessage = "Logical error: nothing: function returns no value."
+        },
+        EvaluatorErrorTest{
+            .description = "22. Value of a function returning none #2",
+            .expression = "fnc nothing() {} fnc show(int a) { print(a); } show(nothing())",
+            .errorMessage = "Logical error: nothing: function returns no value."
+        },
+        EvaluatorErrorTest{
+            .description = "23. Value of a function returning none #3",
+            .expression = "fnc nothing() {} int n = nothing()",
+            .errorMessage = "Logical error: nothing: function returns no value."
+        },
+        EvaluatorErrorTest{
+            .description = "24. Value of a function returning none #4",
+            .expression = "fnc nothing() {} fnc one() int { return nothing(); } one()",
+            .errorMessage =
+                "Logical error: invalid return type in call : returned object is of type void, but expected return "
+                "type is int."
         }
     };
 
-    Evaluator evaluator;
+    for (auto mode : evaluatorModes) {
+        Evaluator evaluator(std::cout, mode);
+
+        for (const auto &test: testCases) {
+            std::cout << test.description << std::endl;
+
+            bool hasThrown = false;
+
+            try {
+                evaluator.feed(test.expression + ";");
+            } catch (const LogicalError &err) {
+                hasThrown = true;
+
+                EXPECT_STREQ(err.what(), test.errorMessage.c_str());
+            } catch (const SyntaxError &err) {
+                hasThrown = true;
+
+                EXPECT_STREQ(err.what(), test.errorMessage.c_str());
+            }
+
+            EXPECT_TRUE(hasThrown);
 
-    for (const auto &test: testCases) {
-        std::cout << test.description << std::endl;
+            evaluator.clear();
+        }
+    }
+}
 
-        bool hasThrown = false;
+TEST(EvaluatorTest, Builtins)
+{
+    for (auto mode : evaluatorModes) {
+        std::stringstream output;
+        Evaluator evaluator(output, mode);
+
+        evaluator.feed(
+            "str s = \"hello world\";"
+            "print(len(s));"
+            "print(substr(s, 6, 100));"
+            "print(min(3, -4) + max(3, -4) + abs(-12));"
+            "print(toString(parseInt(\"-42\")) + \"!\");"
+            "fnc last(str s) str { return substr(s, len(s) - 1, 1); }"
+            "print(last(s));"
+        );
 
         try {
-            evaluator.feed(test.expression + ";");
+            evaluator.feed("print(len(1));");
+            FAIL();
         } catch (const LogicalError &err) {
-            hasThrown = true;
+            EXPECT_STREQ(err.what(), "Logical error: invalid type in call : s is of type int but expected type str.");
+        }
 
-            EXPECT_STREQ(err.what(), test.errorMessage.c_str());
-        } catch (const SyntaxError &err) {
-            hasThrown = true;
+        try {
+            evaluator.feed("print(parseInt(\"12a\"));");
+            FAIL();
+        } catch (const LogicalError &err) {
+            EXPECT_STREQ(err.what(), "Logical error: parseInt: \"12a\" is not an integer.");
+        }
 
-            EXPECT_STREQ(err.what(), test.errorMessage.c_str());
+        try {
+            evaluator.feed("print(abs(-2147483647 - 1));");
+            FAIL();
+        } catch (const LogicalError &err) {
+            EXPECT_STREQ(err.what(), "Logical error: abs: -2147483648 has no representable absolute value.");
         }
 
-        EXPECT_TRUE(hasThrown);
+        // Globals shadow the builtins from their declaration on, and in every function of the program declaring them
+        evaluator.feed(
+            "print(max(1, 2));"
+            "int max = 10;"
+            "fnc min(int a, int b) int { return a; }"
+            "fnc low() int { return min(5, 1) + max; }"
+            "print(low());"
+        );
+        evaluator.feed("fnc len(str s) int { return 0; } print(len(s) + max);");
+        EXPECT_THROW(evaluator.feed("abs = len;"), LogicalError);
 
+        // Functions defined by the host are kept when the global state is cleared
+        evaluator.define(runtime::Builtin::create(
+            "twice",
+            {{"n", Token::INT_TYPE}},
+            Token::INT_TYPE,
+            [](std::span<const runtime::Object> args) { return runtime::Object(args[0].getInteger() * 2); }
+        ));
         evaluator.clear();
+        evaluator.feed("print(twice(len(\"abc\")));");
+
+        EXPECT_THROW(evaluator.define(runtime::Builtin::create("twice", {}, Token::VOID_TYPE, nullptr)), LogicalError);
+        EXPECT_EQ(output.str(), "11\nworld\n11\n-42!\nd\n2\n15\n10\n6\n");
     }
 }
+
+TEST(EvaluatorTest, Cache)
+{
+    const std::string program =
+        "int a = 2;\n"
+        "fnc double(int n) int { return n * 2; }\n"
+        "for (int i = 0; i < 3; i++) a = double(a);\n"
+        "print(\"a =\");\n"
+        "print(a);\n";
+
+    auto path = std::filesystem::temp_directory_path() / "evaluator_test_cache.huc";
+    vm::Cache cache(path);
+
+    std::filesystem::remove(path);
+
+    for (auto cached: {false, true}) {
+        std::stringstream output;
+        Evaluator evaluator(output, Evaluator::Mode::BYTECODE);
+
+        EXPECT_EQ(cache.load(program, *runtime::State::create()).has_value(), cached);
+
+        evaluator.feed(program, cache);
+
+        EXPECT_EQ(output.str(), "a =\n16\n");
+        EXPECT_EQ(evaluator.getState().get("a")->getInteger(), 16);
+    }
+
+    // Any change of the source makes the entry stale
+    EXPECT_FALSE(cache.load(program + " ", *runtime::State::create()).has_value());
+
+    std::filesystem::remove(path);
+}
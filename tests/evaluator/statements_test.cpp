@@ -11,22 +11,29 @@ struct StatementTest
     bool shouldThrow = false;
 };
 
+static const std::vector<Evaluator::Mode> evaluatorModes{
+    Evaluator::Mode::TREE_WALKING,
+    Evaluator::Mode::BYTECODE
+};
+
 void testStatements(const std::vector<StatementTest> &testCases)
 {
-    for (const auto &tc: testCases) {
-        std::cout << tc.description << std::endl;
+    for (auto mode : evaluatorModes) {
+        for (const auto &tc: testCases) {
+            std::cout << tc.description << std::endl;
 
-        std::ostringstream out;
+            std::ostringstream out;
 
-        Evaluator evaluator(out);
+            Evaluator evaluator(out, mode);
 
-        if (tc.shouldThrow) {
-            EXPECT_THROW(evaluator.feed(tc.program), LogicalError);
-            continue;
-        }
+            if (tc.shouldThrow) {
+                EXPECT_THROW(evaluator.feed(tc.program), LogicalError);
+                continue;
+            }
 
-        EXPECT_NO_THROW(evaluator.feed(tc.program));
-        EXPECT_STREQ(out.str().c_str(), tc.expectedOutput.c_str());
+            EXPECT_NO_THROW(evaluator.feed(tc.program));
+            EXPECT_STREQ(out.str().c_str(), tc.expectedOutput.c_str());
+        }
     }
 }
 
@@ -81,6 +88,60 @@ TEST(StatementTest, Blocks)
                        "}                                           ",
             .expectedOutput = "84\n"
 
+        },
+        StatementTest{
+            .description = "7. Blocks without declarations among scoped ones",
+            .program = "{                                           "
+                       "    int n = 1;                              "
+                       "    {                                       "
+                       "        {                                   "
+                       "            int m = n + 1;                  "
+                       "            { { print(m + n); } }           "
+                       "        }                                   "
+                       "        n = 5;                              "
+                       "    }                                       "
+                       "    print(n);                               "
+                       "}                                           ",
+            .expectedOutput = "3\n5\n"
+        },
+        StatementTest{
+            .description = "8. Jumps out of blocks without declarations",
+            .program = "int total = 0;                              "
+                       "for (int i = 0; i < 10; i++) {              "
+                       "    { if (i == 2) { continue; } }           "
+                       "    {                                       "
+                       "        int twice = i * 2;                  "
+                       "        { if (i == 5) { break; } }          "
+                       "        { total += twice; }                 "
+                       "    }                                       "
+                       "}                                           "
+                       "print(total);                               ",
+            .expectedOutput = "16\n"
+        },
+        StatementTest{
+            .description = "9. Declaration under a condition of a block",
+            .program = "{ if (1) int n = 4; print(n); }",
+            .expectedOutput = "4\n"
+        },
+        StatementTest{
+            .description = "10. Declaration under a condition which isn't executed",
+            .program = "int n = 1; { if (0) int n = 2; print(n); }",
+            .expectedOutput = "1\n"
+        },
+        StatementTest{
+            .description = "11. Variable read before its declaration in the block",
+            .program = "int n = 1; { print(n); int n = 2; print(n); }",
+            .expectedOutput = "1\n2\n"
+        },
+        StatementTest{
+            .description = "12. Declaration of a previous iteration",
+            .program = "int n = 1;                                  "
+                       "{                                           "
+                       "    for (int i = 0; i < 2; i++)             "
+                       "        if (i == 1) print(n);               "
+                       "        else int n = 5;                     "
+                       "}                                           ",
+            .expectedOutput = "5\n"
         }
     };
 
@@ -581,7 +642,185 @@ TEST(StatementTest, Functions)
             "   }                                   "
             "   foo();                              "
             "}                                      ",
+            .expectedOutput = "",
             .shouldThrow = true
+        },
+        StatementTest{
+            .description = "21. Function accesses variables of its caller",
+            .program =
+            "fnc foo() int {                        "
+            "   return n;                           "
+            "}                                      "
+            "fnc bar() int {                        "
+            "   int n = 42;                         "
+            "   return foo();                       "
+            "}                                      "
+            "print(bar());                          ",
+            .expectedOutput = "42\n"
+        },
+        StatementTest{
+            .description = "22. Function accesses variables of the scope it is declared in",
+            .program =
+            "int m = 1;                             "
+            "fnc outer(int n) int {                 "
+            "   fnc inner(int k) int {              "
+            "       return k + n + m;               "
+            "   }                                   "
+            "   return inner(10);                   "
+            "}                                      "
+            "print(outer(5));                       ",
+            .expectedOutput = "16\n"
+        },
+        StatementTest{
+            .description = "23. Function called after the scope it is declared in",
+            .program =
+            "fnc show() { print(0); }               "
+            "{                                      "
+            "   fnc inner() { print(1); }           "
+            "   show = inner;                       "
+            "   show();                             "
+            "}                                      "
+            "show();                                ",
+            .expectedOutput = "1\n1\n"
+        },
+        StatementTest{
+            .description = "24. Variables of the caller shadow globals",
+            .program =
+            "int x = 1;                             "
+            "fnc f() int { return x; }              "
+            "fnc g() int {                          "
+            "   int x = 2;                          "
+            "   return f();                         "
+            "}                                      "
+            "print(g());                            "
+            "print(f());                            ",
+            .expectedOutput = "2\n1\n"
+        },
+        StatementTest{
+            .description = "25. Declaration under a condition of a function",
+            .program =
+            "int x = 1;                             "
+            "fnc f() int {                          "
+            "   if (0) int x = 2;                   "
+            "   return x;                           "
+            "}                                      "
+            "fnc h(int x) int { return f(); }       "
+            "print(f());                            "
+            "print(h(9));                           ",
+            .expectedOutput = "1\n9\n"
+        },
+        StatementTest{
+            .description = "26. Function reads a variable declared after it",
+            .program =
+            "fnc f() int { return z; }              "
+            "{                                      "
+            "   int z = 4;                          "
+            "   print(f());                         "
+            "}                                      "
+            "int z = 6;                             "
+            "print(f());                            ",
+            .expectedOutput = "4\n6\n"
+        },
+        StatementTest{
+            .description = "27. Function reassigned by a function it calls",
+            .program =
+            "{                                      "
+            "   fnc f(int a) int { return a; }      "
+            "   fnc g(str s) int { return 2; }      "
+            "   fnc swap() { f = g; }               "
+            "   swap();                             "
+            "   print(f(\"a\"));                      "
+            "}                                      ",
+            .expectedOutput = "2\n"
+        }
+    };
+
+    testStatements(testCases);
+}
+
+TEST(StatementTest, TailCalls)
+{
+    std::vector<StatementTest> testCases{
+        StatementTest{
+            .description = "1. Deep tail recursion runs in place",
+            .program =
+            "fnc count(int n, int acc) int {        "
+            "   if (n == 0)                         "
+            "       return acc;                     "
+            "   return count(n - 1, acc + 1);       "
+            "}                                      "
+            "print(count(50000, 0));                ",
+            .expectedOutput = "50000\n"
+        },
+        StatementTest{
+            .description = "2. Tail call from nested scopes",
+            .program =
+            "fnc loop(int n) str {                  "
+            "   while (n > 0) {                     "
+            "       for (int i = 0; i < 2; i++)     "
+            "           return loop(n - 1);         "
+            "   }                                   "
+            "   return \"done\";                    "
+            "}                                      "
+            "print(loop(10000));                    ",
+            .expectedOutput = "done\n"
+        },
+        StatementTest{
+            .description = "3. Tail call to another function",
+            .program =
+            "fnc one(int n) int { return n + 1; }   "
+            "fnc two(int n) int { return one(n); }  "
+            "print(two(1));                         ",
+            .expectedOutput = "2\n"
+        },
+        StatementTest{
+            .description = "4. Tail call to a reassigned function",
+            .program =
+            "fnc other(int n) int { return 42; }    "
+            "fnc self(int n) int {                  "
+            "   self = other;                       "
+            "   return self(n);                     "
+            "}                                      "
+            "print(self(1));                        ",
+            .expectedOutput = "42\n"
+        },
+        StatementTest{
+            .description = "5. Arguments of a tail call are checked",
+            .program =
+            "fnc f(int n) int {                     "
+            "   if (n == 0)                         "
+            "       return 0;                       "
+            "   return f(\"a\");                     "
+            "}                                      "
+            "f(1);                                  ",
+            .expectedOutput = "",
+            .shouldThrow = true
+        },
+        StatementTest{
+            .description = "6. Calls to functions returning no value are returned as well",
+            .program =
+            "fnc nothing() { print(1); }            "
+            "fnc relay(int n) {                     "
+            "   if (n == 0)                         "
+            "       return nothing();               "
+            "   return relay(n - 1);                "
+            "}                                      "
+            "relay(3);                              ",
+            .expectedOutput = "1\n"
+        },
+        StatementTest{
+            .description = "7. Tail calls keep the variables their callees look up",
+            .program =
+            "fnc f() int { return x; }              "
+            "fnc loop(int n) int {                  "
+            "   if (n == 3)                         "
+            "       int x = 7;                      "
+            "   if (n == 0)                         "
+            "       return f();                     "
+            "   return loop(n - 1);                 "
+            "}                                      "
+            "print(loop(3));                        ",
+            .expectedOutput = "7\n"
         }
     };
 
@@ -709,8 +948,125 @@ TEST(StatementTest, BreakAndContinue)
                        "    print(i);"
                        "}",
             .expectedOutput = "0\n"
+        },
+        StatementTest{
+            .description = "9. return from nested loops",
+            .program = "fnc find(int n) int {"
+                       "    for (int i = 0; i < 10; i++) {"
+                       "        int j = 0;"
+                       "        while (j < 10) {"
+                       "            if (i * j == n)"
+                       "                return i * 10 + j;"
+                       "            j++;"
+                       "        }"
+                       "    }"
+                       "    return -1;"
+                       "}"
+                       "print(find(12));"
+                       "print(find(-5));",
+            .expectedOutput = "26\n-1\n"
+        },
+        StatementTest{
+            .description = "10. break in function called from a loop",
+            .program = "fnc stop() { break; }"
+                       "while (1) stop();",
+            .shouldThrow = true,
         }
     };
 
     testStatements(testCases);
 }
+
+TEST(StatementTest, Stream)
+{
+    std::string program =
+        "fnc twice(int n) int {\n"
+        "    return n * 2;\n"
+        "}\n"
+        "int i = 0;\n"
+        "str s = \"multi\n"
+        "line\";\n";
+
+    // Spans several reads of the input
+    for (int line = 0; line < 10000; line++)
+        program += "i++;\n";
+
+    program +=
+        "if (i == 10000)\n"
+        "    print(twice(i));\n"
+        "\n"
+        "else\n"
+        "    print(0);\n"
+        "print(s);\n"
+        "fnc first() { later(); }\n"
+        "fnc later() { print(\"later\"); }\n"
+        "first();";
+
+    for (auto mode : evaluatorModes) {
+        std::ostringstream expected;
+        std::ostringstream out;
+        std::istringstream input(program);
+
+        Evaluator(expected, mode).feed(program);
+        Evaluator evaluator(out, mode);
+
+        EXPECT_NO_THROW(evaluator.stream(input));
+        EXPECT_STREQ(out.str().c_str(), expected.str().c_str());
+        EXPECT_STREQ(out.str().c_str(), "20000\nmulti\nline\nlater\n");
+    }
+
+    for (auto mode : evaluatorModes) {
+        const std::string shadowing =
+            "fnc low() int { return min(5, 1); }\n"
+            "print(low());\n"
+            "fnc min(int a, int b) int { return a; }\n"
+            "print(low());\n";
+        std::ostringstream expected;
+        std::ostringstream out;
+        std::istringstream input(shadowing);
+
+        // A global shadows the builtin of the same identifier once it is defined, whether it is read in a statement
+        // resolved before or after its declaration
+        Evaluator(expected, mode).feed(shadowing);
+        Evaluator(out, mode).stream(input);
+
+        EXPECT_STREQ(out.str().c_str(), expected.str().c_str());
+        EXPECT_STREQ(out.str().c_str(), "1\n5\n");
+    }
+
+    for (auto mode : evaluatorModes) {
+        std::ostringstream out;
+        std::istringstream input("print(1);\nprint(2)\nprint(3);");
+        Evaluator evaluator(out, mode);
+
+        // Statements before a syntax error have already run
+        EXPECT_THROW(evaluator.stream(input), SyntaxError);
+        EXPECT_STREQ(out.str().c_str(), "1\n");
+    }
+
+    for (auto mode : evaluatorModes) {
+        std::ostringstream out;
+        std::istringstream input("print(1);\nprint(2); @ print(3);\nprint(4);");
+        Evaluator evaluator(out, mode);
+
+        // Only an unterminated string may be closed by the rest of the input, other lexical errors are thrown at once
+        try {
+            evaluator.stream(input);
+            FAIL();
+        } catch (const LexicalError &err) {
+            EXPECT_EQ(err.getLine(), 1);
+            EXPECT_EQ(err.getColumn(), 10);
+        }
+
+        EXPECT_STREQ(out.str().c_str(), "1\n2\n");
+    }
+
+    for (auto mode : evaluatorModes) {
+        std::ostringstream out;
+        std::istringstream input("print(1);\nstr s = \"a\nprint(2);");
+        Evaluator evaluator(out, mode);
+
+        EXPECT_THROW(evaluator.stream(input), LexicalError);
+        EXPECT_STREQ(out.str().c_str(), "1\n");
+    }
+}
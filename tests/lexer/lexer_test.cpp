@@ -20,20 +20,20 @@ void testLexer(const std::vector<LexerTest> &testCases)
 
         EXPECT_EQ(lexer.tokensCount(), testCase.expected.size());
 
-        Token::Iterator tokenItr(lexer.getTokens());
+        Token::Buffer tokens(lexer.getTokens());
 
         if (testCase.expected.empty()) {
-            auto token = tokenItr.get();
-            EXPECT_FALSE(token.has_value());
+            auto token = tokens.get();
+            EXPECT_EQ(token, nullptr);
         }
 
         for (const auto &expected: testCase.expected) {
-            auto token = tokenItr.get();
+            auto token = tokens.get();
 
-            EXPECT_TRUE(token.has_value());
+            ASSERT_NE(token, nullptr);
             EXPECT_EQ(*token, expected);
 
-            tokenItr.advance();
+            tokens.advance();
         }
     }
 }
@@ -173,6 +173,12 @@ TEST(LexerTest, Strings)
             .expected   = Token{Token::STRING, "\" \\ \\n \\a\\b \\t \\n \\v \\\" \\f \\r \\\\ \\\\n \""},
             .expectedValue = " \\ \n \a\b \t \n \v \" \f \r \\ \\n ",
         },
+        LexerStringTest{
+            .description = "5. Long string literal with escaped double quotes",
+            .expression = "\"a long string literal spanning blocks \\\" then an escaped quote \\\\\\\"\"",
+            .expected   = Token{Token::STRING, "\"a long string literal spanning blocks \\\" then an escaped quote \\\\\\\"\""},
+            .expectedValue = "a long string literal spanning blocks \" then an escaped quote \\\"",
+        },
     };
 
     for (const auto &testCase: testCases) {
@@ -181,13 +187,13 @@ TEST(LexerTest, Strings)
 
         lexer.feed(testCase.expression);
 
-        Token::Iterator tokenItr(lexer.getTokens());
+        Token::Buffer tokens(lexer.getTokens());
 
-            auto token = tokenItr.get();
+            auto token = tokens.get();
 
-            EXPECT_TRUE(token.has_value());
+            ASSERT_NE(token, nullptr);
             EXPECT_EQ(*token, testCase.expected);
-            EXPECT_STREQ(token->getLiteral<Token::String>().c_str(), testCase.expectedValue.c_str());
+            EXPECT_STREQ(token->getStringLiteral().c_str(), testCase.expectedValue.c_str());
     }
 }
 
@@ -307,6 +313,17 @@ TEST(LexerTest, Identifiers)
                 Token{Token::ASSIGN, "="},
                 Token{Token::INTEGER, "1"}
             }
+        },
+        LexerTest{
+            .description = "5. Long identifiers separated by long white spaces",
+            .expression = "int \t \t   \t \t   \t \t   \t \t   \t \t   \t \t  a_very_long_identifier_NAME_0123456789_abcdefghij\n"
+                          "                                   a_very_long_identifier_NAME_0123456789_abcdefghi;",
+            .expected = {
+                Token{Token::INT_TYPE, "int"},
+                Token{Token::IDENTIFIER, "a_very_long_identifier_NAME_0123456789_abcdefghij"},
+                Token{Token::IDENTIFIER, "a_very_long_identifier_NAME_0123456789_abcdefghi"},
+                Token{Token::SEMICOLON, ";"}
+            }
         }
     };
 
@@ -374,4 +391,29 @@ TEST(LexerTest, InvalidExpressions)
         EXPECT_TRUE(hasThrown);
         EXPECT_EQ(lexer.tokensCount(), 0);
     }
-}
\ No newline at end of file
+}
+TEST(LexerTest, TokenBuffer)
+{
+    Lexer lexer;
+
+    lexer.feed("int a = 1;");
+
+    Token::Buffer tokens(lexer.getTokens());
+
+    EXPECT_EQ(tokens.size(), 5);
+    EXPECT_EQ(tokens.prev(), nullptr);
+    EXPECT_EQ(*tokens.peek(3), (Token{Token::INTEGER, "1"}));
+
+    auto position = tokens.mark();
+
+    tokens.advance(2);
+    EXPECT_EQ(*tokens.get(), (Token{Token::ASSIGN, "="}));
+    EXPECT_EQ(*tokens.prev(), (Token{Token::IDENTIFIER, "a"}));
+
+    tokens.rewind(position);
+    EXPECT_EQ(*tokens.get(), (Token{Token::INT_TYPE, "int"}));
+
+    tokens.advance(10);
+    EXPECT_EQ(tokens.get(), nullptr);
+    EXPECT_EQ(tokens.prev(), nullptr);
+}